@@ -0,0 +1,29 @@
+# Embed the shaders of mxd into the library as constant data.
+#
+# Invoked at build time (see src/CMakeLists.txt) as
+#
+#   cmake -DSHADER_DIR=<directory> -DSHADERS=<a.vert,b.frag,...>
+#         -DOUTPUT=<file> -P EmbedShaders.cmake
+#
+# and writes one table entry per shader, {"<name>", R"mxd(<source>)mxd"},
+# which shader_library.cpp includes.
+
+string(REPLACE "," ";" SHADERS "${SHADERS}")
+
+set(contents "// Generated by EmbedShaders.cmake. Do not edit.\n")
+foreach(shader ${SHADERS})
+  file(READ "${SHADER_DIR}/${shader}" source)
+  string(FIND "${source}" ")mxd\"" delimiter)
+  if(NOT delimiter EQUAL -1)
+    message(FATAL_ERROR "${shader} contains the raw string delimiter )mxd\"")
+  endif()
+  string(APPEND contents "{\"${shader}\", R\"mxd(${source})mxd\"},\n")
+endforeach()
+
+# Leave the file untouched when nothing changed, to avoid needless rebuilds.
+if(EXISTS "${OUTPUT}")
+  file(READ "${OUTPUT}" previous)
+endif()
+if(NOT contents STREQUAL previous)
+  file(WRITE "${OUTPUT}" "${contents}")
+endif()
@@ -0,0 +1,117 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      camera.cpp
+/// @brief     Implementation of camera.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "camera.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+#include <memory>
+
+// mxd Library
+#include "frame_uniforms.hpp"
+#include "frustum.hpp"
+#include "line.hpp"
+#include "mxd.hpp"
+#include "time_point.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {  // anonymous namespace
+
+/// @brief Return the width over the height of the current viewport.
+double viewport_aspect() {
+  nzl::requires_current_context();
+  int viewport[4]{0, 0, 0, 0};
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  return static_cast<double>(std::max(viewport[2], 1)) /
+         std::max(viewport[3], 1);
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+struct Camera::CameraImp {
+  glm::dvec3 eye{0.0, 0.0, 0.0};
+  glm::dvec3 target{0.0, 0.0, -1.0};
+  glm::dvec3 up{0.0, 1.0, 0.0};
+  bool is_perspective{false};
+  double fovy{0.0};
+  double half_height{1.0};
+  double near{-1.0};
+  double far{1.0};
+};
+
+Camera::Camera() : m_pimpl{std::make_shared<CameraImp>()} {}
+
+void Camera::look_at(const glm::dvec3& eye, const glm::dvec3& target,
+                     const glm::dvec3& up) noexcept {
+  m_pimpl->eye = eye;
+  m_pimpl->target = target;
+  m_pimpl->up = up;
+}
+
+void Camera::set_perspective(double fovy, double near, double far) noexcept {
+  m_pimpl->is_perspective = true;
+  m_pimpl->fovy = fovy;
+  m_pimpl->near = near;
+  m_pimpl->far = far;
+}
+
+void Camera::set_orthographic(double half_height, double near,
+                              double far) noexcept {
+  m_pimpl->is_perspective = false;
+  m_pimpl->half_height = half_height;
+  m_pimpl->near = near;
+  m_pimpl->far = far;
+}
+
+glm::dvec3 Camera::eye() const noexcept { return m_pimpl->eye; }
+
+glm::dvec3 Camera::target() const noexcept { return m_pimpl->target; }
+
+glm::dmat4 Camera::view() const noexcept {
+  return glm::lookAt(m_pimpl->eye, m_pimpl->target, m_pimpl->up);
+}
+
+glm::dmat4 Camera::projection(double aspect) const noexcept {
+  auto&& c = *m_pimpl;
+  if (c.is_perspective) {
+    return glm::perspective(c.fovy, aspect, c.near, c.far);
+  }
+  const double half_width = c.half_height * aspect;
+  return glm::ortho(-half_width, half_width, -c.half_height, c.half_height,
+                    c.near, c.far);
+}
+
+glm::dmat4 Camera::eye_transform(double aspect) const noexcept {
+  // Dropping the translation leaves the view relative to the eye.
+  auto rotation = view();
+  rotation[3] = glm::dvec4(0.0, 0.0, 0.0, 1.0);
+  return projection(aspect) * rotation;
+}
+
+Frustum Camera::frustum(double aspect) const noexcept {
+  return Frustum(projection(aspect) * view());
+}
+
+void Camera::apply(TimePoint t) const {
+  const auto aspect = viewport_aspect();
+  FrameUniforms::update(glm::mat4(view()), glm::mat4(projection(aspect)), t);
+}
+
+void Camera::apply(Line& line) const {
+  line.set_eye(m_pimpl->eye);
+  line.set_transform(glm::mat4(eye_transform(viewport_aspect())));
+}
+
+}  // namespace nzl
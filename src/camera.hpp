@@ -0,0 +1,101 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      camera.hpp
+/// @brief     Viewpoint and projection of a frame.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <memory>
+
+// mxd Library
+#include "frustum.hpp"
+#include "time_point.hpp"
+
+// Third party forward declaration only headers
+#include <glm/fwd.hpp>
+
+namespace nzl {
+
+class Line;
+
+/// @brief A viewpoint and a projection, in double precision.
+///
+/// Applying a Camera to a frame sets the view and projection of the
+/// FrameUniforms, and with them the frustum every Geometry is culled against
+/// (see Geometry::render). By default the camera looks down -z from the
+/// origin through an orthographic projection of the unit cube, so vertices in
+/// normalized device coordinates stay in view.
+class Camera {
+ public:
+  /// @brief Create the default camera.
+  Camera();
+
+  /// @brief Place the camera.
+  /// @param eye Position of the camera.
+  /// @param target Point at the center of the view.
+  /// @param up Direction that appears upwards.
+  /// @note Affects all copies of this object.
+  void look_at(const glm::dvec3& eye, const glm::dvec3& target,
+               const glm::dvec3& up) noexcept;
+
+  /// @brief Use a perspective projection.
+  /// @param fovy Vertical field of view, in radians.
+  /// @param near Distance to the near plane.
+  /// @param far Distance to the far plane.
+  /// @note Affects all copies of this object.
+  void set_perspective(double fovy, double near, double far) noexcept;
+
+  /// @brief Use an orthographic projection.
+  /// @param half_height Half the height of the view, in world units.
+  /// @param near Distance to the near plane.
+  /// @param far Distance to the far plane.
+  /// @note Affects all copies of this object.
+  void set_orthographic(double half_height, double near, double far) noexcept;
+
+  /// @brief Return the position of the camera.
+  glm::dvec3 eye() const noexcept;
+
+  /// @brief Return the point at the center of the view.
+  glm::dvec3 target() const noexcept;
+
+  /// @brief Return the world-to-eye matrix.
+  glm::dmat4 view() const noexcept;
+
+  /// @brief Return the eye-to-clip matrix.
+  /// @param aspect Width over height of the viewport.
+  glm::dmat4 projection(double aspect) const noexcept;
+
+  /// @brief Return the projection times the rotation of the view, which maps
+  /// positions relative to the eye to clip space (see Line::set_transform).
+  /// @param aspect Width over height of the viewport.
+  glm::dmat4 eye_transform(double aspect) const noexcept;
+
+  /// @brief Return the frustum of the camera.
+  /// @param aspect Width over height of the viewport.
+  Frustum frustum(double aspect) const noexcept;
+
+  /// @brief Make this the camera of the frame of the current context.
+  /// @param t Current epoch.
+  /// @throws std::runtime_error if there is no current context.
+  ///
+  /// The aspect is that of the current viewport. The matrices are uploaded in
+  /// single precision, which cannot resolve small details far from the
+  /// origin; draw those with double-precision Lines (see apply(Line&)).
+  void apply(TimePoint t) const;
+
+  /// @brief Draw a Line with double-precision points from this camera.
+  /// @param line Line whose eye and transform are set.
+  /// @throws std::runtime_error if there is no current context.
+  /// @note The aspect is that of the current viewport.
+  void apply(Line& line) const;
+
+ private:
+  struct CameraImp;
+  std::shared_ptr<CameraImp> m_pimpl;
+};
+
+}  // namespace nzl
@@ -0,0 +1,140 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      camera.t.cpp
+/// @brief     Unit tests for camera.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "camera.hpp"
+
+// C++ Standard Library
+#include <stdexcept>
+#include <vector>
+
+// mxd Library
+#include "ellipse.hpp"
+#include "frame_uniforms.hpp"
+#include "frustum.hpp"
+#include "line.hpp"
+#include "mxd.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+TEST(Camera, Defaults) {
+  // The default camera keeps normalized device coordinates in view.
+  nzl::Camera camera;
+  EXPECT_EQ(camera.eye(), glm::dvec3(0.0));
+  const auto frustum = camera.frustum(1.0);
+  EXPECT_TRUE(frustum.contains(glm::dvec3(0.0)));
+  EXPECT_TRUE(frustum.contains(glm::dvec3(0.5, -0.5, 0.5)));
+  EXPECT_FALSE(frustum.contains(glm::dvec3(2.0, 0.0, 0.0)));
+
+  // Copies share the camera.
+  auto copy = camera;
+  copy.look_at(glm::dvec3(1.0, 2.0, 3.0), glm::dvec3(0.0),
+               glm::dvec3(0.0, 1.0, 0.0));
+  EXPECT_EQ(camera.eye(), glm::dvec3(1.0, 2.0, 3.0));
+
+  EXPECT_THROW(camera.apply(nzl::TimePoint()), std::runtime_error);
+}
+
+TEST(Camera, ApplySetsTheFrame) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Camera camera;
+  camera.look_at(glm::dvec3(0.0, 0.0, 10.0), glm::dvec3(0.0),
+                 glm::dvec3(0.0, 1.0, 0.0));
+  camera.set_perspective(glm::radians(60.0), 1.0, 100.0);
+  camera.apply(nzl::TimePoint());
+  EXPECT_EQ(nzl::FrameUniforms::view(), glm::mat4(camera.view()));
+  EXPECT_TRUE(nzl::FrameUniforms::frustum().contains(glm::dvec3(0.0)));
+  EXPECT_FALSE(
+      nzl::FrameUniforms::frustum().contains(glm::dvec3(0.0, 0.0, 20.0)));
+
+  // Culled geometries issue no draw, and no error.
+  nzl::Ellipse ellipse(1.0f, 2.0f, 100, glm::vec3(1.0f));
+  ellipse.set_center(glm::vec2(500.0f, 0.0f));
+  const auto bounds = ellipse.bounds();
+  ASSERT_TRUE(bounds.has_value());
+  EXPECT_NEAR(bounds->minimum[0], 499.0, 1e-6);
+  EXPECT_NEAR(bounds->maximum[1], 2.0, 1e-6);
+  EXPECT_FALSE(nzl::FrameUniforms::frustum().intersects(*bounds));
+  ellipse.render(nzl::TimePoint());
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(Camera, CullsLineChunks) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  // A line along x, one unit per segment, seen through a view two units
+  // tall and less than three wide.
+  std::vector<glm::vec3> points;
+  for (int k = 0; k <= 4000; ++k) {
+    points.emplace_back(k, 0.0f, 0.0f);
+  }
+  nzl::Line line;
+  line.load_points(points);
+
+  nzl::Camera camera;
+  const auto look_at_x = [&](double x) {
+    camera.look_at(glm::dvec3(x, 0.0, 0.0), glm::dvec3(x, 0.0, -1.0),
+                   glm::dvec3(0.0, 1.0, 0.0));
+    camera.apply(nzl::TimePoint());
+    line.render(nzl::TimePoint());
+  };
+
+  // Only the chunk of 256 segments in view is drawn.
+  look_at_x(50.0);
+  EXPECT_EQ(line.rendered_points(), 257);
+
+  // Adjacent chunks are drawn as a single strip.
+  look_at_x(256.0);
+  EXPECT_EQ(line.rendered_points(), 513);
+
+  // The last chunk holds the remaining segments.
+  look_at_x(4000.0);
+  EXPECT_EQ(line.rendered_points(), 4001 - 3840);
+
+  // Double-precision points are culled relative to the eye.
+  std::vector<glm::dvec3> precise;
+  for (int k = 0; k <= 4000; ++k) {
+    precise.emplace_back(1.0e9 + k, 0.0, 0.0);
+  }
+  nzl::Line far_line;
+  far_line.load_points(precise);
+  EXPECT_FALSE(far_line.bounds().has_value());
+  camera.look_at(glm::dvec3(1.0e9 + 1000.5, 0.0, 0.0),
+                 glm::dvec3(1.0e9 + 1000.5, 0.0, -1.0),
+                 glm::dvec3(0.0, 1.0, 0.0));
+  camera.apply(far_line);
+  far_line.render(nzl::TimePoint());
+  EXPECT_EQ(far_line.rendered_points(), 257);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -10,15 +10,23 @@
 #include "ellipse.hpp"
 
 // C++ Standard Library
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
 
 // mxd Library
+#include "frame_uniforms.hpp"
 #include "program.hpp"
+#include "program_cache.hpp"
+#include "render_state.hpp"
 #include "shader.hpp"
+#include "shader_library.hpp"
 #include "time_point.hpp"
-#include "utilities.hpp"
+#include "vertex_array.hpp"
 
 // Third party libraries
 #include <GL/glew.h>
@@ -26,27 +34,24 @@
 #include <glm/glm.hpp>
 
 namespace {  // anonymous namespace
-nzl::Program create_program() {
-  const std::string vertex_shader_source =
-      nzl::slurp(nzl::get_env_var("SHADERS_PATH") + "/simple_shader.vert");
 
-  const std::string fragment_shader_source =
-      nzl::slurp(nzl::get_env_var("SHADERS_PATH") + "/simple_shader.frag");
-
-  nzl::Shader vert_shader(nzl::Shader::Stage::Vertex, vertex_shader_source);
-  vert_shader.compile();
-
-  nzl::Shader frag_shader(nzl::Shader::Stage::Fragment, fragment_shader_source);
-  frag_shader.compile();
-
-  std::vector<nzl::Shader> vec;
-  vec.push_back(vert_shader);
-  vec.push_back(frag_shader);
-
-  nzl::Program program{vec};
-  program.compile();
-
-  return program;
+nzl::Program create_program(nzl::Ellipse::Mode mode, bool wide) {
+  // Every Ellipse of the same kind shares the same linked Program.
+  const auto vertex_source = nzl::ShaderLibrary::get(
+      (mode == nzl::Ellipse::Mode::Procedural) ? "ellipse_shader.vert"
+                                               : "simple_shader.vert");
+  if (wide) {
+    return nzl::ProgramCache::get(
+        {{nzl::Shader::Stage::Vertex, vertex_source},
+         {nzl::Shader::Stage::Geometry,
+          nzl::ShaderLibrary::get("wide_line.geom")},
+         {nzl::Shader::Stage::Fragment,
+          nzl::ShaderLibrary::get("wide_line.frag")}});
+  }
+  return nzl::ProgramCache::get(
+      {{nzl::Shader::Stage::Vertex, vertex_source},
+       {nzl::Shader::Stage::Fragment,
+        nzl::ShaderLibrary::get("simple_shader.frag")}});
 }
 
 std::vector<glm::vec3> gen_points(float rX, float rY, float number_of_points) {
@@ -62,59 +67,206 @@ std::vector<glm::vec3> gen_points(float rX, float rY, float number_of_points) {
 
   return points;
 }
+
+/// Bounds on the parameter step of adaptive sampling. The largest step keeps
+/// nearly flat ellipses from collapsing to a handful of points; the smallest
+/// caps the number of points for vanishing tolerances.
+const float max_adaptive_step = 3.14159265358979f / 8.0f;
+const float min_adaptive_step = 1.0e-5f;
+
+/// @brief Return the parameter step at @p t for which the sagitta of the
+/// chord equals @p max_deviation.
+///
+/// For a chord of arc length L on a curve of curvature k the sagitta is
+/// k L^2 / 8. On the ellipse (rX cos t, rY sin t), k = rX rY / |r'|^3 and
+/// L = |r'| dt, so dt = sqrt(8 h |r'| / (rX rY)).
+float adaptive_step(float rX, float rY, float max_deviation, float t) {
+  const float speed = std::hypot(rX * std::sin(t), rY * std::cos(t));
+  const float product = std::abs(rX * rY);
+  if (product == 0.0f) {
+    return max_adaptive_step;
+  }
+  const float step = std::sqrt(8.0f * max_deviation * speed / product);
+  return std::clamp(step, min_adaptive_step, max_adaptive_step);
+}
+
+/// @brief Generate points spaced by curvature (see adaptive_step).
+std::vector<glm::vec3> gen_adaptive_points(float rX, float rY,
+                                           float max_deviation) {
+  const float two_pi = 2.0f * 3.14159265358979f;
+  std::vector<glm::vec3> points;
+  float t = 0.0f;
+  while (t < two_pi) {
+    points.emplace_back(rX * std::cos(t), rY * std::sin(t), 0.0f);
+
+    // The curvature changes along the step; honor the tighter end.
+    const float step = adaptive_step(rX, rY, max_deviation, t);
+    t += std::min(step, adaptive_step(rX, rY, max_deviation, t + step));
+  }
+  return points;
+}
+
+/// @brief Rotate @p points by @p angle and translate them to @p center.
+void place_points(std::vector<glm::vec3>& points, glm::vec2 center,
+                  float angle) {
+  const float c = cos(angle);
+  const float s = sin(angle);
+  for (auto&& p : points) {
+    p = glm::vec3(center.x + c * p.x - s * p.y, center.y + s * p.x + c * p.y,
+                  p.z);
+  }
+}
 }  // anonymous namespace
 
 namespace nzl {
 
 struct Ellipse::IDContainer {
   glm::vec3 m_color;
-  unsigned int m_vao_id;
-  unsigned int m_vbo_id;
+  Ellipse::Mode m_mode;
+  float m_rx;
+  float m_ry;
+  glm::vec2 m_center{0.0f, 0.0f};
+  float m_rotation{0.0f};
   int m_number_of_points{0};
+  float m_max_deviation{0.0f};
+  nzl::VertexArray m_vertex_array;
+  unsigned int m_vbo_id{0};
+  int m_number_of_vertices{0};
   nzl::Program m_program;
-
-  IDContainer(glm::vec3 color, float rX, float rY, float number_of_points)
-      : m_color{color}, m_program{create_program()} {
-    glGenVertexArrays(1, &m_vao_id);
-
-    glBindVertexArray(m_vao_id);
+  unsigned int m_program_revision{0};
+  nzl::UniformHandle<glm::vec3> m_color_uniform;
+
+  // Only used by procedural ellipses.
+  nzl::UniformHandle<glm::vec2> m_radii_uniform;
+  nzl::UniformHandle<glm::vec2> m_center_uniform;
+  nzl::UniformHandle<float> m_rotation_uniform;
+  nzl::UniformHandle<int> m_number_of_points_uniform;
+
+  // Only used by wide ellipses (see Ellipse::set_width).
+  float m_width{1.0f};
+  bool m_is_wide{false};
+  nzl::UniformHandle<float> m_width_uniform;
+
+  IDContainer(glm::vec3 color, float rX, float rY, int number_of_points,
+              Ellipse::Mode mode, float max_deviation = 0.0f)
+      : m_color{color},
+        m_mode{mode},
+        m_rx{rX},
+        m_ry{rY},
+        m_number_of_points{number_of_points},
+        m_max_deviation{max_deviation},
+        m_vertex_array{[this] { layout(); }},
+        m_program{create_program(mode, false)} {
+    find_uniforms();
+
+    if (m_mode == Ellipse::Mode::Procedural) {
+      // The vertex array stays empty, but core profiles require one to draw.
+      return;
+    }
 
     glGenBuffers(1, &m_vbo_id);
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_vbo_id);
+    upload_points();
+  }
 
-    std::vector<glm::vec3> points{gen_points(rX, rY, number_of_points)};
+  ~IDContainer() {
+    auto& state = RenderState::current();
+    state.forget_buffer(m_vbo_id);
+    glDeleteBuffers(1, &m_vbo_id);
+  }
 
-    // Add the first point again, so the first point is connected to the last.
-    points.push_back(points.front());
+  /// @brief Point attribute 0 at the vertex buffer of a buffered ellipse.
+  void layout() {
+    if (m_mode != Ellipse::Mode::Buffered) {
+      return;
+    }
 
-    m_number_of_points = points.size();
-
-    glBufferData(GL_ARRAY_BUFFER, points.size() * 3 * sizeof(float),
-                 points.data(), GL_STATIC_DRAW);
+    RenderState::current().bind_buffer(GL_ARRAY_BUFFER, m_vbo_id);
 
     glEnableVertexAttribArray(0);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float),
                           (void*)0);
+  }
 
-    glDisableVertexAttribArray(0);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  /// @brief Look up the uniforms of the current program.
+  /// @note Called again whenever the program is relinked (see
+  /// ShaderLibrary::reload).
+  void find_uniforms() {
+    m_program_revision = m_program.revision();
+    m_color_uniform = m_program.uniform<glm::vec3>("color");
+    if (m_mode == Ellipse::Mode::Procedural) {
+      m_radii_uniform = m_program.uniform<glm::vec2>("radii");
+      m_center_uniform = m_program.uniform<glm::vec2>("center");
+      m_rotation_uniform = m_program.uniform<float>("rotation");
+      m_number_of_points_uniform = m_program.uniform<int>("number_of_points");
+    }
+    if (m_is_wide) {
+      m_width_uniform = m_program.uniform<float>("width");
+    }
+  }
 
-    glBindVertexArray(0);
+  /// @brief Switch between the plain and the wide line program.
+  void set_wide(bool wide) {
+    if (wide != m_is_wide) {
+      m_is_wide = wide;
+      m_program = create_program(m_mode, wide);
+      find_uniforms();
+    }
   }
 
-  ~IDContainer() {
-    glDeleteVertexArrays(1, &m_vao_id);
-    glDeleteBuffers(1, &m_vbo_id);
+  /// @brief Regenerate the points of a buffered ellipse and upload them.
+  void upload_points() {
+    if (m_mode != Ellipse::Mode::Buffered) {
+      return;
+    }
+
+    std::vector<glm::vec3> points;
+    if (m_max_deviation > 0.0f) {
+      points = gen_adaptive_points(m_rx, m_ry, m_max_deviation);
+      m_number_of_points = points.size();
+    } else {
+      points = gen_points(m_rx, m_ry, m_number_of_points);
+    }
+    place_points(points, m_center, m_rotation);
+
+    // Add the first point again, so the first point is connected to the last.
+    if (!points.empty()) {
+      points.push_back(points.front());
+    }
+
+    m_number_of_vertices = points.size();
+
+    RenderState::current().bind_buffer(GL_ARRAY_BUFFER, m_vbo_id);
+
+    glBufferData(GL_ARRAY_BUFFER, points.size() * 3 * sizeof(float),
+                 points.data(), GL_STATIC_DRAW);
   }
 };
 
-Ellipse::Ellipse(float rX, float rY, int number_of_points,
-                 glm::vec3 color) noexcept
-    : m_id_container{
-          std::make_shared<IDContainer>(color, rX, rY, number_of_points)} {}
+Ellipse::Ellipse(float rX, float rY, int number_of_points, glm::vec3 color)
+    : Ellipse(rX, rY, number_of_points, color, Mode::Buffered) {}
+
+Ellipse::Ellipse(float rX, float rY, int number_of_points, glm::vec3 color,
+                 Mode mode)
+    : m_id_container{std::make_shared<IDContainer>(color, rX, rY,
+                                                   number_of_points, mode)} {}
+
+Ellipse::Ellipse(std::shared_ptr<IDContainer> id_container) noexcept
+    : m_id_container{std::move(id_container)} {}
+
+Ellipse Ellipse::adaptive(float rX, float rY, float max_deviation,
+                          glm::vec3 color) {
+  if (!(max_deviation > 0.0f)) {
+    std::ostringstream oss;
+    oss << "Cannot create an adaptive Ellipse with maximum deviation "
+        << max_deviation;
+    throw std::runtime_error(oss.str());
+  }
+  // Constructed in adaptive mode, so the points are generated only once.
+  return Ellipse(std::make_shared<IDContainer>(
+      color, rX, rY, 0, Mode::Buffered, max_deviation));
+}
 
 glm::vec3 Ellipse::color() const noexcept { return m_id_container->m_color; }
 
@@ -122,23 +274,100 @@ void Ellipse::set_color(glm::vec3 color) noexcept {
   m_id_container->m_color = color;
 }
 
+Ellipse::Mode Ellipse::mode() const noexcept { return m_id_container->m_mode; }
+
+void Ellipse::set_radii(float rX, float rY) {
+  m_id_container->m_rx = rX;
+  m_id_container->m_ry = rY;
+  m_id_container->upload_points();
+}
+
+void Ellipse::set_center(glm::vec2 center) {
+  m_id_container->m_center = center;
+  m_id_container->upload_points();
+}
+
+void Ellipse::set_rotation(float angle) {
+  m_id_container->m_rotation = angle;
+  m_id_container->upload_points();
+}
+
+void Ellipse::set_number_of_points(int number_of_points) {
+  m_id_container->m_number_of_points = number_of_points;
+  m_id_container->m_max_deviation = 0.0f;
+  m_id_container->upload_points();
+}
+
+void Ellipse::set_max_deviation(float max_deviation) {
+  m_id_container->m_max_deviation = std::max(max_deviation, 0.0f);
+  m_id_container->upload_points();
+}
+
+float Ellipse::max_deviation() const noexcept {
+  return m_id_container->m_max_deviation;
+}
+
+int Ellipse::number_of_points() const noexcept {
+  return m_id_container->m_number_of_points;
+}
+
+void Ellipse::set_width(float pixels) {
+  m_id_container->m_width = pixels;
+  m_id_container->set_wide(pixels > 1.0f);
+}
+
+float Ellipse::width() const noexcept { return m_id_container->m_width; }
+
 nzl::Program Ellipse::get_program() const noexcept {
   return m_id_container->m_program;
 }
 
+Geometry::DrawKey Ellipse::do_draw_key() const noexcept {
+  return {m_id_container->m_program.id(),
+          m_id_container->m_vertex_array.key(), false};
+}
+
+std::optional<Bounds> Ellipse::do_bounds() const {
+  // The box of the rotated ellipse; its points all lie on the curve.
+  auto&& c = *m_id_container;
+  const double cos_angle = std::cos(c.m_rotation);
+  const double sin_angle = std::sin(c.m_rotation);
+  const double half_width = std::hypot(c.m_rx * cos_angle, c.m_ry * sin_angle);
+  const double half_height =
+      std::hypot(c.m_rx * sin_angle, c.m_ry * cos_angle);
+  const glm::dvec3 center(c.m_center.x, c.m_center.y, 0.0);
+  Bounds bounds;
+  bounds.extend(center - glm::dvec3(half_width, half_height, 0.0));
+  bounds.extend(center + glm::dvec3(half_width, half_height, 0.0));
+  return bounds;
+}
+
 void Ellipse::do_render(TimePoint t [[maybe_unused]]) {
-  m_id_container->m_program.use();
-  m_id_container->m_program.set("color", m_id_container->m_color);
+  auto&& c = *m_id_container;
 
-  glBindVertexArray(m_id_container->m_vao_id);
+  if (c.m_program.revision() != c.m_program_revision) {
+    c.find_uniforms();
+  }
+  c.m_program.use();
+  c.m_program.set(c.m_color_uniform, c.m_color);
 
-  glEnableVertexAttribArray(0);
+  if (c.m_is_wide) {
+    FrameUniforms::refresh_viewport();
+    c.m_program.set(c.m_width_uniform, c.m_width);
+  }
 
-  glDrawArrays(GL_LINE_STRIP, 0, m_id_container->m_number_of_points);
+  c.m_vertex_array.bind();
 
-  glDisableVertexAttribArray(0);
+  if (c.m_mode == Mode::Procedural) {
+    c.m_program.set(c.m_radii_uniform, glm::vec2(c.m_rx, c.m_ry));
+    c.m_program.set(c.m_center_uniform, c.m_center);
+    c.m_program.set(c.m_rotation_uniform, c.m_rotation);
+    c.m_program.set(c.m_number_of_points_uniform, c.m_number_of_points);
 
-  glBindVertexArray(0);
+    glDrawArrays(GL_LINE_LOOP, 0, c.m_number_of_points);
+  } else {
+    glDrawArrays(GL_LINE_STRIP, 0, c.m_number_of_vertices);
+  }
 }
 
 }  // namespace nzl
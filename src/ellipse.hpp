@@ -24,12 +24,104 @@ namespace nzl {
 
 class Ellipse : public Geometry {
  public:
+  /// @brief How the points of an Ellipse are produced.
+  enum class Mode {
+    /// Points are computed on the CPU and stored in a vertex buffer.
+    Buffered,
+    /// Points are synthesized by the vertex shader from gl_VertexID. The
+    /// ellipse owns no vertex buffer, and changing its shape or its number of
+    /// points is a uniform update.
+    Procedural,
+  };
+
+  /// @brief Creates an ellipse.
+  /// @param rX Radius in the x direction.
+  /// @param rY Radius in the y direction.
+  /// @param number_of_points Number of points to be generated for the ellipse.
+  /// @param color Color the ellipse will be drawn with.
+  /// @throws std::runtime_error if the shaders fail to compile or link.
+  Ellipse(float rX, float rY, int number_of_points, glm::vec3 color);
+
   /// @brief Creates an ellipse.
   /// @param rX Radius in the x direction.
   /// @param rY Radius in the y direction.
   /// @param number_of_points Number of points to be generated for the ellipse.
   /// @param color Color the ellipse will be drawn with.
-  Ellipse(float rX, float rY, int number_of_points, glm::vec3 color) noexcept;
+  /// @param mode How the points of the ellipse are produced.
+  /// @throws std::runtime_error if the shaders fail to compile or link.
+  Ellipse(float rX, float rY, int number_of_points, glm::vec3 color,
+          Mode mode);
+
+  /// @brief Creates a buffered ellipse whose points are placed by curvature.
+  ///
+  /// Instead of a fixed number of points at uniform steps, points are spaced
+  /// so that no chord strays from the true curve by more than
+  /// @p max_deviation. Points crowd where the curvature is high and thin out
+  /// along flat arcs. Highly eccentric ellipses therefore look smooth with
+  /// far fewer vertices.
+  ///
+  /// @param rX Radius in the x direction.
+  /// @param rY Radius in the y direction.
+  /// @param max_deviation Largest allowed distance between a chord and the
+  /// ellipse, in the same units as the radii (divide a pixel tolerance by
+  /// the pixel size to obtain it).
+  /// @param color Color the ellipse will be drawn with.
+  /// @throws std::runtime_error if @p max_deviation is not positive, or if
+  /// the shaders fail to compile or link.
+  /// @throws std::bad_alloc if the points cannot be generated.
+  static Ellipse adaptive(float rX, float rY, float max_deviation,
+                          glm::vec3 color);
+
+  /// @brief Return how the points of the ellipse are produced.
+  Mode mode() const noexcept;
+
+  /// @brief Sets the radii of the ellipse.
+  /// @param rX Radius in the x direction.
+  /// @param rY Radius in the y direction.
+  /// @throws std::bad_alloc if the points cannot be generated.
+  /// @note Buffered ellipses regenerate and re-upload their points.
+  /// @note Affects all copies of this object.
+  void set_radii(float rX, float rY);
+
+  /// @brief Sets the center of the ellipse.
+  /// @param center Center of the ellipse.
+  /// @throws std::bad_alloc if the points cannot be generated.
+  /// @note Buffered ellipses regenerate and re-upload their points.
+  /// @note Affects all copies of this object.
+  void set_center(glm::vec2 center);
+
+  /// @brief Sets the rotation of the ellipse about its center.
+  /// @param angle Counter-clockwise angle, in radians, of the x radius.
+  /// @throws std::bad_alloc if the points cannot be generated.
+  /// @note Buffered ellipses regenerate and re-upload their points.
+  /// @note Affects all copies of this object.
+  void set_rotation(float angle);
+
+  /// @brief Sets the number of points used to draw the ellipse.
+  /// @param number_of_points Number of points.
+  /// @throws std::bad_alloc if the points cannot be generated.
+  /// @note Buffered ellipses regenerate and re-upload their points.
+  /// @note Adaptive ellipses revert to uniform steps.
+  /// @note Affects all copies of this object.
+  void set_number_of_points(int number_of_points);
+
+  /// @brief Sets the largest allowed deviation between a chord and the
+  /// ellipse (see adaptive()).
+  /// @param max_deviation Deviation in the units of the radii; zero reverts to
+  /// a fixed number of points at uniform steps.
+  /// @throws std::bad_alloc if the points cannot be generated.
+  /// @note Only buffered ellipses are affected; they regenerate and re-upload
+  /// their points.
+  /// @note Affects all copies of this object.
+  void set_max_deviation(float max_deviation);
+
+  /// @brief Return the largest allowed deviation, or zero if the ellipse uses
+  /// a fixed number of points.
+  float max_deviation() const noexcept;
+
+  /// @brief Return the number of points used to draw the ellipse.
+  /// @note For adaptive ellipses, this is the number of points generated.
+  int number_of_points() const noexcept;
 
   /// @brief Return the ellipse's color.
   glm::vec3 color() const noexcept;
@@ -39,6 +131,17 @@ class Ellipse : public Geometry {
   /// @note Affects all copies of this object.
   void set_color(glm::vec3 color) noexcept;
 
+  /// @brief Sets the width of the ellipse.
+  /// @param pixels Width in pixels (one by default).
+  ///
+  /// Lines wider than one pixel are expanded on the GPU by a geometry shader
+  /// (see Line::set_width), for both buffered and procedural ellipses.
+  /// @note Affects all copies of this object.
+  void set_width(float pixels);
+
+  /// @brief Returns the width of the ellipse, in pixels.
+  float width() const noexcept;
+
   /// @brief Returns the program used by the ellipse.
   nzl::Program get_program() const noexcept;
 
@@ -46,7 +149,11 @@ class Ellipse : public Geometry {
   struct IDContainer;
   std::shared_ptr<IDContainer> m_id_container{nullptr};
 
+  explicit Ellipse(std::shared_ptr<IDContainer> id_container) noexcept;
+
   void do_render(TimePoint t) override;
+  DrawKey do_draw_key() const noexcept override;
+  std::optional<Bounds> do_bounds() const override;
 };
 
 }  // namespace nzl
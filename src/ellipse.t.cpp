@@ -10,9 +10,12 @@
 #include "ellipse.hpp"
 
 // C++ Standard Library
+#include <cmath>
+#include <stdexcept>
 #include <vector>
 
 // mxd Library
+#include "frame_uniforms.hpp"
 #include "mxd.hpp"
 #include "time_point.hpp"
 #include "window.hpp"
@@ -64,6 +67,138 @@ TEST(Ellipse, Draw) {
   EXPECT_EQ(glGetError(), 0);
 }
 
+TEST(Ellipse, Setters) {
+  nzl::initialize();
+  nzl::Window win(600, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Ellipse ellipse(0.1f, 0.9f, 40, glm::vec3(1.0f, 0.0f, 0.0f));
+  EXPECT_EQ(ellipse.mode(), nzl::Ellipse::Mode::Buffered);
+  EXPECT_EQ(ellipse.number_of_points(), 40);
+
+  ellipse.set_radii(0.5f, 0.2f);
+  ellipse.set_center(glm::vec2(0.1f, -0.1f));
+  ellipse.set_rotation(0.3f);
+  ellipse.set_number_of_points(100);
+  EXPECT_EQ(ellipse.number_of_points(), 100);
+
+  ellipse.render(nzl::TimePoint());
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Ellipse, ProceduralDraw) {
+  nzl::initialize();
+  nzl::Window win(600, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Ellipse ellipse(0.1f, 0.9f, 40, glm::vec3(1.0f, 0.0f, 0.0f),
+                       nzl::Ellipse::Mode::Procedural);
+  EXPECT_EQ(ellipse.mode(), nzl::Ellipse::Mode::Procedural);
+
+  // Procedural and buffered ellipses use different programs.
+  nzl::Ellipse buffered(0.1f, 0.9f, 40, glm::vec3(1.0f, 0.0f, 0.0f));
+  EXPECT_NE(ellipse.get_program().id(), buffered.get_program().id());
+
+  for (int i = 0; i < 3; i++) {
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    ellipse.set_radii(0.1f * (i + 1), 0.9f);
+    ellipse.set_rotation(0.1f * i);
+    ellipse.set_number_of_points(40 * (i + 1));
+    ellipse.render(nzl::TimePoint());
+
+    win.swap_buffers();
+  }
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Ellipse, Adaptive) {
+  nzl::initialize();
+  nzl::Window win(600, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  // A transfer orbit with e = 0.97.
+  const float a = 0.9f;
+  const float b = a * std::sqrt(1.0f - 0.97f * 0.97f);
+  const float h = 1.0e-4f;
+
+  auto ellipse = nzl::Ellipse::adaptive(a, b, h, glm::vec3(1.0f, 0.0f, 0.0f));
+  EXPECT_EQ(ellipse.mode(), nzl::Ellipse::Mode::Buffered);
+  EXPECT_FLOAT_EQ(ellipse.max_deviation(), h);
+
+  // Uniform steps need dt = sqrt(8 h / a) to meet the tolerance at the
+  // sharpest end; curvature-based steps need fewer points.
+  const int uniform = std::ceil(2.0f * 3.14159265f / std::sqrt(8.0f * h / a));
+  EXPECT_GT(ellipse.number_of_points(), 8);
+  EXPECT_LT(ellipse.number_of_points(), uniform);
+
+  // Tighter tolerances need more points.
+  const auto coarse = ellipse.number_of_points();
+  ellipse.set_max_deviation(h / 10.0f);
+  EXPECT_GT(ellipse.number_of_points(), coarse);
+
+  ellipse.render(nzl::TimePoint());
+
+  // A fixed number of points disables adaptive sampling.
+  ellipse.set_number_of_points(100);
+  EXPECT_FLOAT_EQ(ellipse.max_deviation(), 0.0f);
+  EXPECT_EQ(ellipse.number_of_points(), 100);
+
+  EXPECT_THROW(nzl::Ellipse::adaptive(a, b, 0.0f, glm::vec3(1.0f)),
+               std::runtime_error);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Ellipse, Width) {
+  nzl::initialize();
+  nzl::Window win(600, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Ellipse buffered(0.5f, 0.3f, 60, glm::vec3(1.0f, 0.0f, 0.0f));
+  nzl::Ellipse procedural(0.3f, 0.5f, 60, glm::vec3(0.0f, 1.0f, 0.0f),
+                          nzl::Ellipse::Mode::Procedural);
+  const auto thin = buffered.get_program().id();
+  EXPECT_FLOAT_EQ(buffered.width(), 1.0f);
+
+  buffered.set_width(5.0f);
+  procedural.set_width(5.0f);
+  EXPECT_FLOAT_EQ(buffered.width(), 5.0f);
+  EXPECT_NE(buffered.get_program().id(), thin);
+
+  for (int i = 0; i < 3; i++) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    buffered.render(nzl::TimePoint());
+    procedural.set_radii(0.1f * (i + 1), 0.5f);
+    procedural.render(nzl::TimePoint());
+    win.swap_buffers();
+  }
+
+  // Wide strokes follow a resized viewport without FrameUniforms::update().
+  glViewport(0, 0, 300, 200);
+  procedural.render(nzl::TimePoint());
+  EXPECT_EQ(nzl::FrameUniforms::viewport(), glm::vec2(300.0f, 200.0f));
+
+  buffered.set_width(1.0f);
+  EXPECT_EQ(buffered.get_program().id(), thin);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
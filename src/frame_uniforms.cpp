@@ -0,0 +1,220 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      frame_uniforms.cpp
+/// @brief     Implementation of frame_uniforms.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "frame_uniforms.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+
+// mxd Library
+#include "frustum.hpp"
+#include "mxd.hpp"
+#include "render_state.hpp"
+#include "time_point.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+/// @brief Contents of the Frame block, laid out as std140.
+struct Block {
+  glm::mat4 view{1.0f};
+  glm::mat4 projection{1.0f};
+  glm::mat4 view_projection{1.0f};
+  glm::vec2 viewport{1.0f, 1.0f};
+  float time_high{0.0f};
+  float time_low{0.0f};
+};
+
+static_assert(sizeof(Block) == 3 * 64 + 16,
+              "Block must match the std140 layout of the Frame block");
+
+/// @brief Frame state of one OpenGL context.
+struct Frame {
+  unsigned int buffer_id{0};
+  Block block;
+  nzl::TimePoint time;
+  nzl::Frustum frustum;
+};
+
+std::mutex frames_mutex;
+std::map<GLFWwindow*, Frame> frames;
+
+/// @brief Read the size of the current viewport into @p block.
+void read_viewport(Block& block) noexcept {
+  int viewport[4]{0, 0, 0, 0};
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  block.viewport =
+      glm::vec2(std::max(viewport[2], 1), std::max(viewport[3], 1));
+}
+
+/// @brief Bind the buffer of @p frame at FrameUniforms::binding.
+void bind_block(const Frame& frame) noexcept {
+  // glBindBufferBase also binds the generic target; let the RenderState know.
+  nzl::RenderState::current().bind_buffer(GL_UNIFORM_BUFFER, frame.buffer_id);
+  glBindBufferBase(GL_UNIFORM_BUFFER, nzl::FrameUniforms::binding,
+                   frame.buffer_id);
+}
+
+/// @brief Return the frame of the current context, creating and binding its
+/// buffer on first use. Requires frames_mutex.
+Frame& current_frame() {
+  nzl::requires_current_context();
+  auto& frame = frames[glfwGetCurrentContext()];
+  if (frame.buffer_id == 0) {
+    read_viewport(frame.block);
+    glGenBuffers(1, &frame.buffer_id);
+    nzl::RenderState::current().bind_buffer(GL_UNIFORM_BUFFER, frame.buffer_id);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(Block), &frame.block,
+                 GL_DYNAMIC_DRAW);
+    bind_block(frame);
+  }
+  return frame;
+}
+
+/// @brief Upload @p size bytes of the block of @p frame, from @p offset.
+void upload(const Frame& frame, std::size_t offset, std::size_t size) noexcept {
+  nzl::RenderState::current().bind_buffer(GL_UNIFORM_BUFFER, frame.buffer_id);
+  glBufferSubData(GL_UNIFORM_BUFFER, offset, size,
+                  reinterpret_cast<const char*>(&frame.block) + offset);
+}
+
+/// Incremented whenever a frame changes, so stale per-thread copies are never
+/// used.
+std::atomic<unsigned long> generation{0};
+
+/// Copy of the frame state read on every draw, kept by each thread for the
+/// context last current in it, so that culling and level selection take no
+/// lock.
+struct View {
+  GLFWwindow* context{nullptr};
+  unsigned long generation{0};
+  nzl::Frustum frustum;
+  glm::mat4 view_projection{1.0f};
+  glm::vec2 viewport{1.0f, 1.0f};
+};
+
+thread_local View current_view;
+
+/// @brief Copy @p frame of @p context to the view of this thread.
+/// @note Requires frames_mutex.
+void store_view(GLFWwindow* context, const Frame& frame) noexcept {
+  current_view.context = context;
+  current_view.generation = generation.load(std::memory_order_acquire);
+  current_view.frustum = frame.frustum;
+  current_view.view_projection = frame.block.view_projection;
+  current_view.viewport = frame.block.viewport;
+}
+
+/// @brief Return the view of the current context, refreshing it under the
+/// lock only if a frame changed since it was stored.
+const View& find_view() {
+  const auto context = glfwGetCurrentContext();
+  if (context != nullptr && current_view.context == context &&
+      current_view.generation == generation.load(std::memory_order_acquire)) {
+    return current_view;
+  }
+
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  store_view(context, current_frame());
+  return current_view;
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+void FrameUniforms::update(const glm::mat4& view, const glm::mat4& projection,
+                           TimePoint t) {
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  auto& frame = current_frame();
+  auto& block = frame.block;
+  block.view = view;
+  block.projection = projection;
+  block.view_projection = projection * view;
+  frame.frustum = Frustum(glm::dmat4(projection) * glm::dmat4(view));
+  read_viewport(block);
+  const auto seconds = t.elapsed().seconds();
+  block.time_high = static_cast<float>(seconds);
+  block.time_low = static_cast<float>(seconds - block.time_high);
+  frame.time = t;
+  upload(frame, 0, sizeof(Block));
+  generation.fetch_add(1, std::memory_order_acq_rel);
+  store_view(glfwGetCurrentContext(), frame);
+}
+
+void FrameUniforms::update_viewport() {
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  auto& frame = current_frame();
+  read_viewport(frame.block);
+  upload(frame, offsetof(Block, viewport), sizeof(glm::vec2));
+  generation.fetch_add(1, std::memory_order_acq_rel);
+  store_view(glfwGetCurrentContext(), frame);
+}
+
+void FrameUniforms::refresh_viewport() {
+  Block block;
+  read_viewport(block);
+  if (block.viewport != find_view().viewport) {
+    update_viewport();
+  }
+}
+
+glm::mat4 FrameUniforms::view() {
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  return current_frame().block.view;
+}
+
+glm::mat4 FrameUniforms::projection() {
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  return current_frame().block.projection;
+}
+
+TimePoint FrameUniforms::time() {
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  return current_frame().time;
+}
+
+const Frustum& FrameUniforms::frustum() { return find_view().frustum; }
+
+glm::mat4 FrameUniforms::view_projection() {
+  return find_view().view_projection;
+}
+
+glm::vec2 FrameUniforms::viewport() { return find_view().viewport; }
+
+void FrameUniforms::bind() {
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  bind_block(current_frame());
+}
+
+void FrameUniforms::release(GLFWwindow* context) noexcept {
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  frames.erase(context);
+  generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void FrameUniforms::clear() noexcept {
+  std::lock_guard<std::mutex> lock(frames_mutex);
+  if (auto it = frames.find(glfwGetCurrentContext()); it != frames.end()) {
+    RenderState::current().forget_buffer(it->second.buffer_id);
+    glDeleteBuffers(1, &it->second.buffer_id);
+  }
+  frames.clear();
+  generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+}  // namespace nzl
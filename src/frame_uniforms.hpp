@@ -0,0 +1,120 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      frame_uniforms.hpp
+/// @brief     Per-frame uniform block shared by every Program.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+
+// mxd Library
+#include "frustum.hpp"
+#include "time_point.hpp"
+
+// Third party forward declaration only headers
+#include <glm/fwd.hpp>
+
+/// GLFW context handle (declared here to keep GLFW out of mxd headers).
+struct GLFWwindow;
+
+namespace nzl {
+
+/// @brief Process-wide uniform buffer holding the values that are constant
+/// over a frame: the camera, the viewport, and the current epoch.
+///
+/// Every OpenGL context gets one buffer, bound once (when the context is
+/// first made current) at the fixed binding point FrameUniforms::binding. Any
+/// Program declaring the block below is connected to that binding point when
+/// it is linked, so a camera costs a single buffer update per frame no matter
+/// how many programs use it:
+///
+/// @code
+/// layout(std140) uniform Frame {
+///   mat4 view;             // World to eye.
+///   mat4 projection;       // Eye to clip.
+///   mat4 view_projection;  // projection * view.
+///   vec2 viewport;         // Viewport size, in pixels.
+///   float time_high;       // Current epoch in seconds past J2000 ...
+///   float time_low;        // ... split into a float and its remainder.
+/// } frame;
+/// @endcode
+///
+/// Every built-in shader transforms its vertices by view_projection. The
+/// matrices are the identity until update() is called, so by default vertices
+/// are in normalized device coordinates.
+class FrameUniforms {
+ public:
+  /// @brief Uniform buffer binding point of the Frame block.
+  static constexpr unsigned int binding = 0;
+
+  /// @brief Update the block of the current context for a new frame.
+  /// @param view World-to-eye matrix.
+  /// @param projection Eye-to-clip matrix.
+  /// @param t Current epoch.
+  /// @note The viewport is read from the current OpenGL state, so call it
+  /// after glViewport. The whole block is uploaded with a single call.
+  /// @note Also sets the frustum geometries are culled against.
+  static void update(const glm::mat4& view, const glm::mat4& projection,
+                     TimePoint t);
+
+  /// @brief Update only the viewport of the block of the current context,
+  /// reading it from the current OpenGL state.
+  /// @note Called by OffscreenTarget::bind and OffscreenTarget::unbind.
+  static void update_viewport();
+
+  /// @brief Update the viewport of the block of the current context only if
+  /// the current OpenGL viewport differs from it.
+  /// @note Called by wide Lines and Ellipses before every draw, so strokes
+  /// keep their width in pixels after a resize even if update() is not
+  /// called. The comparison takes no lock.
+  static void refresh_viewport();
+
+  /// @brief Return the view matrix of the current context.
+  static glm::mat4 view();
+
+  /// @brief Return the projection matrix of the current context.
+  static glm::mat4 projection();
+
+  /// @brief Return the epoch of the current context.
+  static TimePoint time();
+
+  /// @brief Return projection * view of the current context.
+  /// @throws std::runtime_error if there is no current context.
+  /// @note Kept by the calling thread, like frustum().
+  static glm::mat4 view_projection();
+
+  /// @brief Return the viewport size of the current context, in pixels, as
+  /// read by the last update() or update_viewport().
+  /// @throws std::runtime_error if there is no current context.
+  /// @note Kept by the calling thread, like frustum(), so it costs no OpenGL
+  /// query.
+  static glm::vec2 viewport();
+
+  /// @brief Return the frustum of projection * view of the current context.
+  /// @throws std::runtime_error if there is no current context.
+  /// @note Until update() is first called, the frustum contains everything,
+  /// so geometries drawn in normalized device coordinates are never culled.
+  /// @note Computed once by update() and kept by the calling thread, so the
+  /// lookup made by every Geometry::render takes no lock. The referenced
+  /// frustum is overwritten by the next update() or frustum() on this thread.
+  static const Frustum& frustum();
+
+  /// @brief Bind the block of the current context at FrameUniforms::binding,
+  /// creating it with identity matrices on first use.
+  /// @note Called by Window the first time its context is made current.
+  static void bind();
+
+  /// @brief Discard the block associated with a context.
+  /// @param context Context about to be destroyed.
+  static void release(GLFWwindow* context) noexcept;
+
+  /// @brief Discard every block.
+  /// @note Only the buffer of the current context is deleted; the others are
+  /// released with their contexts.
+  static void clear() noexcept;
+};
+
+}  // namespace nzl
@@ -0,0 +1,128 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      frame_uniforms.t.cpp
+/// @brief     Unit tests for frame_uniforms.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "frame_uniforms.hpp"
+
+// C++ Standard Library
+#include <stdexcept>
+#include <vector>
+
+// mxd Library
+#include "duration.hpp"
+#include "ellipse.hpp"
+#include "line.hpp"
+#include "mxd.hpp"
+#include "program_cache.hpp"
+#include "shader.hpp"
+#include "shader_library.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+TEST(FrameUniforms, DefaultsAndUpdate) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  // Every context starts with a bound block of identity matrices.
+  int buffer_id{0};
+  glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, nzl::FrameUniforms::binding,
+                  &buffer_id);
+  EXPECT_NE(buffer_id, 0);
+  EXPECT_EQ(nzl::FrameUniforms::view(), glm::mat4(1.0f));
+  EXPECT_EQ(nzl::FrameUniforms::projection(), glm::mat4(1.0f));
+
+  glm::mat4 view(1.0f);
+  view[3] = glm::vec4(1.0f, 2.0f, 3.0f, 1.0f);
+  glm::mat4 projection(0.5f);
+  projection[3][3] = 1.0f;
+  const auto t = nzl::TimePoint(nzl::Duration::Days(9000.25));
+  nzl::FrameUniforms::update(view, projection, t);
+
+  EXPECT_EQ(nzl::FrameUniforms::view(), view);
+  EXPECT_EQ(nzl::FrameUniforms::projection(), projection);
+  EXPECT_DOUBLE_EQ(nzl::FrameUniforms::time().elapsed().seconds(),
+                   t.elapsed().seconds());
+
+  // The buffer holds the std140 layout documented in the header.
+  std::vector<float> block(52);
+  glBindBuffer(GL_UNIFORM_BUFFER, buffer_id);
+  glGetBufferSubData(GL_UNIFORM_BUFFER, 0, block.size() * sizeof(float),
+                     block.data());
+  const auto view_projection = projection * view;
+  EXPECT_FLOAT_EQ(block[32 + 12], view_projection[3][0]);
+  EXPECT_FLOAT_EQ(block[32 + 13], view_projection[3][1]);
+  int viewport[4]{0, 0, 0, 0};
+  glGetIntegerv(GL_VIEWPORT, viewport);
+  EXPECT_FLOAT_EQ(block[48], static_cast<float>(viewport[2]));
+  EXPECT_FLOAT_EQ(block[49], static_cast<float>(viewport[3]));
+  EXPECT_DOUBLE_EQ(double(block[50]) + double(block[51]),
+                   t.elapsed().seconds());
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(FrameUniforms, ProgramsUseTheBlock) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  auto program = nzl::ProgramCache::get(
+      {{nzl::Shader::Stage::Vertex,
+        nzl::ShaderLibrary::get("simple_shader.vert")},
+       {nzl::Shader::Stage::Fragment,
+        nzl::ShaderLibrary::get("simple_shader.frag")}});
+  const auto index = glGetUniformBlockIndex(program.id(), "Frame");
+  ASSERT_NE(index, GL_INVALID_INDEX);
+  int binding{-1};
+  glGetActiveUniformBlockiv(program.id(), index, GL_UNIFORM_BLOCK_BINDING,
+                            &binding);
+  EXPECT_EQ(binding, static_cast<int>(nzl::FrameUniforms::binding));
+
+  // Geometries draw through the camera of the frame.
+  nzl::Line line;
+  std::vector<glm::vec3> points{{-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}};
+  line.load_points(points);
+  nzl::Ellipse ellipse(0.5f, 0.25f, 100, glm::vec3(1.0f));
+  ellipse.set_width(3.0f);
+
+  for (int i = 0; i < 3; ++i) {
+    glm::mat4 view(1.0f);
+    view[3] = glm::vec4(0.1f * i, 0.0f, 0.0f, 1.0f);
+    nzl::FrameUniforms::update(view, glm::mat4(1.0f), nzl::TimePoint());
+    glClear(GL_COLOR_BUFFER_BIT);
+    line.render(nzl::TimePoint());
+    ellipse.render(nzl::TimePoint());
+    win.swap_buffers();
+  }
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(FrameUniforms, RequiresCurrentContext) {
+  EXPECT_THROW(nzl::FrameUniforms::update_viewport(), std::runtime_error);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
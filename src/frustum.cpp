@@ -0,0 +1,103 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      frustum.cpp
+/// @brief     Implementation of frustum.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "frustum.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+
+// Third party libraries
+#include <glm/glm.hpp>
+
+namespace nzl {
+
+bool Bounds::is_empty() const noexcept {
+  return !(minimum[0] <= maximum[0] && minimum[1] <= maximum[1] &&
+           minimum[2] <= maximum[2]);
+}
+
+void Bounds::extend(const glm::dvec3& point) noexcept {
+  for (int i = 0; i < 3; ++i) {
+    minimum[i] = std::min(minimum[i], point[i]);
+    maximum[i] = std::max(maximum[i], point[i]);
+  }
+}
+
+void Bounds::extend(const Bounds& other) noexcept {
+  for (int i = 0; i < 3; ++i) {
+    minimum[i] = std::min(minimum[i], other.minimum[i]);
+    maximum[i] = std::max(maximum[i], other.maximum[i]);
+  }
+}
+
+Bounds Bounds::translated(const glm::dvec3& offset) const noexcept {
+  auto result = *this;
+  for (int i = 0; i < 3; ++i) {
+    result.minimum[i] += offset[i];
+    result.maximum[i] += offset[i];
+  }
+  return result;
+}
+
+Frustum::Frustum() noexcept {
+  // The plane 0 x + 0 y + 0 z + 1 = 0 has every point on its inner side.
+  for (auto&& plane : m_planes) {
+    plane[0] = plane[1] = plane[2] = 0.0;
+    plane[3] = 1.0;
+  }
+}
+
+Frustum::Frustum(const glm::dmat4& clip_from_world) noexcept {
+  // A point is inside when -w <= x, y, z <= w in clip space (Gribb and
+  // Hartmann): each inequality is a plane made of rows of the matrix. glm
+  // matrices are column-major, so row i is m[0][i], m[1][i], ...
+  const auto& m = clip_from_world;
+  for (int axis = 0; axis < 3; ++axis) {
+    for (int side = 0; side < 2; ++side) {
+      const double sign = (side == 0) ? 1.0 : -1.0;
+      auto& plane = m_planes[2 * axis + side];
+      for (int j = 0; j < 4; ++j) {
+        plane[j] = m[j][3] + sign * m[j][axis];
+      }
+    }
+  }
+}
+
+bool Frustum::intersects(const Bounds& bounds) const noexcept {
+  if (bounds.is_empty()) {
+    return false;
+  }
+
+  // The box is outside if its corner farthest along the normal of any plane
+  // is behind that plane.
+  for (auto&& plane : m_planes) {
+    double distance = plane[3];
+    for (int i = 0; i < 3; ++i) {
+      distance += plane[i] * ((plane[i] >= 0.0) ? bounds.maximum[i]
+                                                : bounds.minimum[i]);
+    }
+    if (distance < 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Frustum::contains(const glm::dvec3& point) const noexcept {
+  for (auto&& plane : m_planes) {
+    if (plane[0] * point.x + plane[1] * point.y + plane[2] * point.z +
+            plane[3] <
+        0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace nzl
@@ -0,0 +1,73 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      frustum.hpp
+/// @brief     Bounding boxes and view frusta for CPU culling.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <limits>
+
+// Third party forward declaration only headers
+#include <glm/fwd.hpp>
+
+namespace nzl {
+
+/// @brief Axis-aligned bounding box, in double precision.
+///
+/// A default-constructed box is empty; extending it by a point makes it the
+/// smallest box containing that point.
+struct Bounds {
+  double minimum[3]{std::numeric_limits<double>::infinity(),
+                    std::numeric_limits<double>::infinity(),
+                    std::numeric_limits<double>::infinity()};
+  double maximum[3]{-std::numeric_limits<double>::infinity(),
+                    -std::numeric_limits<double>::infinity(),
+                    -std::numeric_limits<double>::infinity()};
+
+  /// @brief Return whether the box contains no point at all.
+  bool is_empty() const noexcept;
+
+  /// @brief Grow the box to contain @p point.
+  void extend(const glm::dvec3& point) noexcept;
+
+  /// @brief Grow the box to contain @p other.
+  void extend(const Bounds& other) noexcept;
+
+  /// @brief Return the box moved by @p offset.
+  Bounds translated(const glm::dvec3& offset) const noexcept;
+};
+
+/// @brief The six planes bounding the volume a transformation maps into clip
+/// space.
+///
+/// Used to skip, on the CPU, geometries that cannot produce a single pixel.
+/// Tests are conservative: a box reported as outside is certainly invisible,
+/// but a box reported as intersecting may still be clipped entirely.
+class Frustum {
+ public:
+  /// @brief Create a frustum that contains everything.
+  Frustum() noexcept;
+
+  /// @brief Create the frustum of a transformation.
+  /// @param clip_from_world Transformation to clip space, typically
+  /// projection * view.
+  explicit Frustum(const glm::dmat4& clip_from_world) noexcept;
+
+  /// @brief Return whether @p bounds may be visible.
+  /// @note Empty bounds are never visible.
+  bool intersects(const Bounds& bounds) const noexcept;
+
+  /// @brief Return whether @p point is inside the frustum.
+  bool contains(const glm::dvec3& point) const noexcept;
+
+ private:
+  /// Planes (a, b, c, d); a point p is inside when a p.x + b p.y + c p.z + d
+  /// is not negative for all six.
+  double m_planes[6][4];
+};
+
+}  // namespace nzl
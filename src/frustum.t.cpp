@@ -0,0 +1,103 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      frustum.t.cpp
+/// @brief     Unit tests for frustum.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "frustum.hpp"
+
+// C++ Standard Library
+
+// mxd Library
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {  // anonymous namespace
+
+nzl::Bounds box(const glm::dvec3& a, const glm::dvec3& b) {
+  nzl::Bounds bounds;
+  bounds.extend(a);
+  bounds.extend(b);
+  return bounds;
+}
+
+}  // anonymous namespace
+
+TEST(Bounds, Extend) {
+  nzl::Bounds bounds;
+  EXPECT_TRUE(bounds.is_empty());
+
+  bounds.extend(glm::dvec3(1.0, -2.0, 3.0));
+  EXPECT_FALSE(bounds.is_empty());
+  EXPECT_EQ(bounds.minimum[1], -2.0);
+  EXPECT_EQ(bounds.maximum[1], -2.0);
+
+  bounds.extend(box({-1.0, 0.0, 0.0}, {0.0, 5.0, 0.0}));
+  EXPECT_EQ(bounds.minimum[0], -1.0);
+  EXPECT_EQ(bounds.maximum[0], 1.0);
+  EXPECT_EQ(bounds.maximum[1], 5.0);
+  EXPECT_EQ(bounds.minimum[2], 0.0);
+
+  const auto moved = bounds.translated(glm::dvec3(10.0, 0.0, 0.0));
+  EXPECT_EQ(moved.minimum[0], 9.0);
+  EXPECT_EQ(moved.maximum[0], 11.0);
+
+  // Extending by an empty box changes nothing.
+  bounds.extend(nzl::Bounds());
+  EXPECT_EQ(bounds.minimum[0], -1.0);
+}
+
+TEST(Frustum, DefaultContainsEverything) {
+  nzl::Frustum frustum;
+  EXPECT_TRUE(frustum.intersects(box({1e30, 1e30, 1e30}, {2e30, 2e30, 2e30})));
+  EXPECT_TRUE(frustum.contains(glm::dvec3(-1e30, 0.0, 0.0)));
+  EXPECT_FALSE(frustum.intersects(nzl::Bounds()));
+}
+
+TEST(Frustum, IdentityIsTheClipCube) {
+  nzl::Frustum frustum(glm::dmat4(1.0));
+  EXPECT_TRUE(frustum.contains(glm::dvec3(0.0, 0.0, 0.0)));
+  EXPECT_TRUE(frustum.contains(glm::dvec3(1.0, -1.0, 1.0)));
+  EXPECT_FALSE(frustum.contains(glm::dvec3(1.5, 0.0, 0.0)));
+
+  EXPECT_TRUE(frustum.intersects(box({-0.5, -0.5, 0.0}, {0.5, 0.5, 0.0})));
+  EXPECT_TRUE(frustum.intersects(box({-5.0, -5.0, -5.0}, {5.0, 5.0, 5.0})));
+  EXPECT_TRUE(frustum.intersects(box({0.9, 0.9, 0.0}, {3.0, 3.0, 0.0})));
+  EXPECT_FALSE(frustum.intersects(box({1.1, -1.0, 0.0}, {3.0, 1.0, 0.0})));
+  EXPECT_FALSE(frustum.intersects(box({-1.0, -3.0, 0.0}, {1.0, -2.0, 0.0})));
+  EXPECT_FALSE(frustum.intersects(box({0.0, 0.0, 2.0}, {0.0, 0.0, 3.0})));
+}
+
+TEST(Frustum, Perspective) {
+  const auto view = glm::lookAt(glm::dvec3(0.0, 0.0, 10.0), glm::dvec3(0.0),
+                                glm::dvec3(0.0, 1.0, 0.0));
+  const auto projection =
+      glm::perspective(glm::radians(90.0), 1.0, 1.0, 100.0);
+  nzl::Frustum frustum(projection * view);
+
+  // In front of the eye, within the 90 degree field of view.
+  EXPECT_TRUE(frustum.contains(glm::dvec3(0.0, 0.0, 0.0)));
+  EXPECT_TRUE(frustum.contains(glm::dvec3(9.0, 0.0, 0.0)));
+  EXPECT_FALSE(frustum.contains(glm::dvec3(11.0, 0.0, 0.0)));
+
+  // Behind the eye, and beyond the far plane.
+  EXPECT_FALSE(frustum.intersects(box({-1.0, -1.0, 11.0}, {1.0, 1.0, 20.0})));
+  EXPECT_FALSE(
+      frustum.intersects(box({-1.0, -1.0, -200.0}, {1.0, 1.0, -100.0})));
+
+  // A box straddling a side plane is kept.
+  EXPECT_TRUE(frustum.intersects(box({9.0, -1.0, -1.0}, {30.0, 1.0, 1.0})));
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -9,8 +9,47 @@
 // Related mxd header
 #include "geometry.hpp"
 
+// C++ Standard Library
+#include <tuple>
+
+// mxd Library
+#include "frame_uniforms.hpp"
+#include "gpu_profiler.hpp"
+
 namespace nzl {
 
-void Geometry::render(TimePoint t) { return this->do_render(t); }
+Geometry::~Geometry() { GpuProfiler::forget(*this); }
+
+void Geometry::render(TimePoint t) {
+  // Cull before the profiler scope, which issues queries of its own.
+  if (const auto box = bounds();
+      box && !FrameUniforms::frustum().intersects(*box)) {
+    return;
+  }
+  GpuProfiler::Scope scope(*this);
+  return this->do_render(t);
+}
+
+Geometry::DrawKey Geometry::draw_key() const noexcept {
+  return this->do_draw_key();
+}
+
+Geometry::DrawKey Geometry::do_draw_key() const noexcept { return {}; }
+
+std::optional<Bounds> Geometry::bounds() const { return this->do_bounds(); }
+
+std::optional<Bounds> Geometry::do_bounds() const { return std::nullopt; }
+
+bool operator<(const Geometry::DrawKey& lhs,
+               const Geometry::DrawKey& rhs) noexcept {
+  return std::tie(lhs.blending, lhs.program, lhs.vertex_array) <
+         std::tie(rhs.blending, rhs.program, rhs.vertex_array);
+}
+
+bool operator==(const Geometry::DrawKey& lhs,
+                const Geometry::DrawKey& rhs) noexcept {
+  return std::tie(lhs.blending, lhs.program, lhs.vertex_array) ==
+         std::tie(rhs.blending, rhs.program, rhs.vertex_array);
+}
 
 }  // namespace nzl
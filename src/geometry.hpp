@@ -8,18 +8,63 @@
 
 #pragma once
 
+// C++ Standard Library
+#include <optional>
+
 // mxd Library
+#include "frustum.hpp"
 #include "time_point.hpp"
 
 namespace nzl {
 
 class Geometry {
  public:
-  virtual ~Geometry() = default;
+  /// @brief OpenGL state a Geometry binds to draw itself.
+  ///
+  /// Draw keys are used to order submissions so that geometries sharing state
+  /// are drawn consecutively (see Scene). Blended geometries sort after opaque
+  /// ones; within each group, keys are ordered by program and then by vertex
+  /// array. Computing a key has no side effects: the vertex array is that of
+  /// VertexArray::key, the same in every context.
+  struct DrawKey {
+    unsigned int program{0};
+    unsigned int vertex_array{0};
+    bool blending{false};
+  };
+
+  virtual ~Geometry();
+
+  /// @brief Draw this Geometry.
+  /// @note Measured by the GpuProfiler when it is enabled.
+  /// @note Geometries whose bounds lie outside the frustum of the frame (see
+  /// FrameUniforms::frustum) are culled: they issue no OpenGL call at all.
   void render(TimePoint t);
 
+  /// @brief Return a box containing every point of this Geometry, or nothing
+  /// if its extent is unknown (such a Geometry is never culled).
+  /// @note Bounds hold the points themselves; wide lines extend a few pixels
+  /// beyond them.
+  std::optional<Bounds> bounds() const;
+
+  /// @brief Return the state this Geometry binds to draw itself.
+  DrawKey draw_key() const noexcept;
+
  private:
   virtual void do_render(TimePoint t) = 0;
+
+  /// @brief Return the draw key; the default key sorts before any other.
+  virtual DrawKey do_draw_key() const noexcept;
+
+  /// @brief Return the bounds; by default they are unknown.
+  virtual std::optional<Bounds> do_bounds() const;
 };
 
+/// @brief Order draw keys by blending, program, and vertex array.
+bool operator<(const Geometry::DrawKey& lhs,
+               const Geometry::DrawKey& rhs) noexcept;
+
+/// @brief Compare two draw keys for equality.
+bool operator==(const Geometry::DrawKey& lhs,
+                const Geometry::DrawKey& rhs) noexcept;
+
 }  // namespace nzl
@@ -10,14 +10,100 @@
 #include "geometry.hpp"
 
 // C++ Standard Library
+#include <optional>
 
 // mxd Library
+#include "frame_uniforms.hpp"
+#include "frustum.hpp"
+#include "mxd.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
 
 // Google Test Framework
 #include <gtest/gtest.h>
 
-TEST(Geometry, Failing) {
-  ASSERT_TRUE(false) << "You must add unit tests for geometry.hpp";
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+/// @brief Geometry that counts its draws instead of issuing them.
+class Probe : public nzl::Geometry {
+ public:
+  explicit Probe(std::optional<nzl::Bounds> bounds) : m_bounds{bounds} {}
+
+  int draws{0};
+
+ private:
+  std::optional<nzl::Bounds> m_bounds;
+
+  void do_render(nzl::TimePoint t [[maybe_unused]]) override { ++draws; }
+
+  std::optional<nzl::Bounds> do_bounds() const override { return m_bounds; }
+};
+
+/// @brief Return the box from @p minimum to @p maximum.
+nzl::Bounds box(const glm::dvec3& minimum, const glm::dvec3& maximum) {
+  nzl::Bounds bounds;
+  bounds.extend(minimum);
+  bounds.extend(maximum);
+  return bounds;
+}
+
+}  // anonymous namespace
+
+TEST(Geometry, CulledGeometriesAreNotDrawn) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  Probe inside(box(glm::dvec3(-0.5), glm::dvec3(0.5)));
+  Probe outside(box(glm::dvec3(5.0), glm::dvec3(6.0)));
+  Probe unbounded(std::nullopt);
+
+  // With the identity frame, the frustum is the cube of normalized device
+  // coordinates.
+  nzl::FrameUniforms::update(glm::mat4(1.0f), glm::mat4(1.0f),
+                             nzl::TimePoint());
+  EXPECT_FALSE(nzl::FrameUniforms::frustum().intersects(*outside.bounds()));
+  inside.render(nzl::TimePoint());
+  outside.render(nzl::TimePoint());
+  unbounded.render(nzl::TimePoint());
+  EXPECT_EQ(inside.draws, 1);
+  EXPECT_EQ(outside.draws, 0);
+  EXPECT_EQ(unbounded.draws, 1);
+
+  // Moving the view brings the other box in and the first one out.
+  glm::mat4 view(1.0f);
+  view[3] = glm::vec4(-5.5f, -5.5f, -5.5f, 1.0f);
+  nzl::FrameUniforms::update(view, glm::mat4(1.0f), nzl::TimePoint());
+  inside.render(nzl::TimePoint());
+  outside.render(nzl::TimePoint());
+  unbounded.render(nzl::TimePoint());
+  EXPECT_EQ(inside.draws, 1);
+  EXPECT_EQ(outside.draws, 1);
+  EXPECT_EQ(unbounded.draws, 2);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(Geometry, DrawKeys) {
+  Probe probe(std::nullopt);
+  EXPECT_EQ(probe.draw_key(), nzl::Geometry::DrawKey{});
+  EXPECT_FALSE(probe.bounds().has_value());
+
+  // Blended keys sort after opaque ones, then by program and vertex array.
+  const nzl::Geometry::DrawKey opaque{2, 7, false};
+  const nzl::Geometry::DrawKey blended{1, 1, true};
+  EXPECT_TRUE(opaque < blended);
+  EXPECT_TRUE(probe.draw_key() < opaque);
+  EXPECT_TRUE((nzl::Geometry::DrawKey{2, 3, false}) < opaque);
+  EXPECT_FALSE(opaque == blended);
 }
 
 int main(int argc, char** argv) {
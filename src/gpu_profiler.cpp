@@ -0,0 +1,292 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      gpu_profiler.cpp
+/// @brief     Implementation of gpu_profiler.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "gpu_profiler.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// mxd Library
+#include "duration.hpp"
+#include "geometry.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace {  // anonymous namespace
+
+/// Measured quantity: a Geometry, or a frame (null).
+using Key = const nzl::Geometry*;
+
+/// Upper bound on queries in flight per context, so a profiler that is never
+/// harvested cannot grow without limit. Samples beyond it are dropped.
+const std::size_t max_pending = 1 << 16;
+
+/// @brief A pair of timestamp queries waiting for their results.
+struct Pending {
+  unsigned int start;
+  unsigned int end;
+  Key key;
+  bool discarded;
+};
+
+/// @brief Profiling state of one OpenGL context.
+struct Profile {
+  std::vector<unsigned int> free_queries;
+  std::deque<Pending> pending;
+  std::map<Key, std::deque<double>> samples;
+
+  /// Number of pending queries of each Geometry, so forgetting a Geometry
+  /// scans the pending queries only if it has some.
+  std::map<Key, std::size_t> in_flight;
+  unsigned int frame_start{0};
+
+  unsigned int acquire() {
+    if (free_queries.empty()) {
+      unsigned int id{0};
+      glGenQueries(1, &id);
+      return id;
+    }
+    auto id = free_queries.back();
+    free_queries.pop_back();
+    return id;
+  }
+
+  unsigned int timestamp() {
+    auto id = acquire();
+    glQueryCounter(id, GL_TIMESTAMP);
+    return id;
+  }
+
+  void destroy() noexcept {
+    for (auto&& p : pending) {
+      free_queries.push_back(p.start);
+      free_queries.push_back(p.end);
+    }
+    if (frame_start != 0) {
+      free_queries.push_back(frame_start);
+    }
+    if (!free_queries.empty()) {
+      glDeleteQueries(static_cast<int>(free_queries.size()),
+                      free_queries.data());
+    }
+  }
+};
+
+std::mutex profiles_mutex;
+std::map<GLFWwindow*, Profile> profiles;
+std::atomic<bool> enabled{false};
+
+/// Whether any Geometry has been measured since the last clear(); until then
+/// forget() returns without taking the lock.
+std::atomic<bool> measured{false};
+std::atomic<std::size_t> window{120};
+
+/// @brief Return the profile of the current context, or null if there is
+/// none. Requires profiles_mutex.
+Profile* current_profile() {
+  auto context = glfwGetCurrentContext();
+  if (context == nullptr) {
+    return nullptr;
+  }
+  return &profiles[context];
+}
+
+void record(Profile& profile, Key key, double seconds) {
+  auto& series = profile.samples[key];
+  series.push_back(seconds);
+  while (series.size() > window.load()) {
+    series.pop_front();
+  }
+}
+
+nzl::GpuProfiler::Statistics summarize(const Profile& profile, Key key) {
+  nzl::GpuProfiler::Statistics statistics;
+  auto it = profile.samples.find(key);
+  if (it == profile.samples.end() || it->second.empty()) {
+    return statistics;
+  }
+
+  const auto& series = it->second;
+  double sum{0};
+  for (auto&& sample : series) {
+    sum += sample;
+  }
+  const auto [minimum, maximum] =
+      std::minmax_element(series.begin(), series.end());
+
+  statistics.samples = series.size();
+  statistics.last = nzl::Duration::Seconds(series.back());
+  statistics.mean = nzl::Duration::Seconds(sum / series.size());
+  statistics.minimum = nzl::Duration::Seconds(*minimum);
+  statistics.maximum = nzl::Duration::Seconds(*maximum);
+  return statistics;
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+void GpuProfiler::set_enabled(bool value) noexcept { enabled = value; }
+
+bool GpuProfiler::is_enabled() noexcept { return enabled; }
+
+void GpuProfiler::set_window(std::size_t value) noexcept {
+  window = std::max<std::size_t>(value, 1);
+}
+
+void GpuProfiler::begin_frame() {
+  harvest();
+  if (!enabled) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  if (auto profile = current_profile();
+      profile != nullptr && profile->frame_start == 0 &&
+      profile->pending.size() < max_pending) {
+    profile->frame_start = profile->timestamp();
+  }
+}
+
+void GpuProfiler::end_frame() {
+  {
+    std::lock_guard<std::mutex> lock(profiles_mutex);
+    if (auto profile = current_profile();
+        profile != nullptr && profile->frame_start != 0) {
+      const auto end = profile->timestamp();
+      profile->pending.push_back({profile->frame_start, end, nullptr, false});
+      profile->frame_start = 0;
+    }
+  }
+  harvest();
+}
+
+void GpuProfiler::harvest() {
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  auto profile = current_profile();
+  if (profile == nullptr) {
+    return;
+  }
+
+  // Queries complete in submission order, so harvesting stops at the first
+  // result that is not available yet.
+  while (!profile->pending.empty()) {
+    auto& p = profile->pending.front();
+    int available{0};
+    glGetQueryObjectiv(p.end, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE) {
+      break;
+    }
+
+    if (!p.discarded) {
+      std::uint64_t start{0};
+      std::uint64_t end{0};
+      glGetQueryObjectui64v(p.start, GL_QUERY_RESULT, &start);
+      glGetQueryObjectui64v(p.end, GL_QUERY_RESULT, &end);
+      record(*profile, p.key, (end - start) * 1.0e-9);
+      if (auto it = profile->in_flight.find(p.key);
+          it != profile->in_flight.end() && --it->second == 0) {
+        profile->in_flight.erase(it);
+      }
+    }
+
+    profile->free_queries.push_back(p.start);
+    profile->free_queries.push_back(p.end);
+    profile->pending.pop_front();
+  }
+}
+
+GpuProfiler::Statistics GpuProfiler::frame_statistics() {
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  auto profile = current_profile();
+  return profile ? summarize(*profile, nullptr) : Statistics{};
+}
+
+GpuProfiler::Statistics GpuProfiler::statistics(const Geometry& geometry) {
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  auto profile = current_profile();
+  return profile ? summarize(*profile, &geometry) : Statistics{};
+}
+
+void GpuProfiler::forget(const Geometry& geometry) noexcept {
+  // Tearing down a scene that was never measured costs no lock.
+  if (!measured) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  for (auto&& [context, profile] : profiles) {
+    profile.samples.erase(&geometry);
+
+    auto it = profile.in_flight.find(&geometry);
+    if (it == profile.in_flight.end()) {
+      continue;
+    }
+
+    // A new Geometry may be created at the same address before these results
+    // arrive.
+    for (auto&& p : profile.pending) {
+      if (p.key == &geometry) {
+        p.discarded = true;
+      }
+    }
+    profile.in_flight.erase(it);
+  }
+}
+
+void GpuProfiler::release(GLFWwindow* context) noexcept {
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  profiles.erase(context);
+}
+
+void GpuProfiler::clear() noexcept {
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  if (auto it = profiles.find(glfwGetCurrentContext()); it != profiles.end()) {
+    it->second.destroy();
+  }
+  profiles.clear();
+  measured = false;
+}
+
+GpuProfiler::Scope::Scope(const Geometry& geometry) {
+  if (!enabled) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  if (auto profile = current_profile();
+      profile != nullptr && profile->pending.size() < max_pending) {
+    m_geometry = &geometry;
+    m_start = profile->timestamp();
+  }
+}
+
+GpuProfiler::Scope::~Scope() noexcept {
+  if (m_start == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(profiles_mutex);
+  if (auto profile = current_profile(); profile != nullptr) {
+    const auto end = profile->timestamp();
+    profile->pending.push_back({m_start, end, m_geometry, false});
+    ++profile->in_flight[m_geometry];
+    measured = true;
+  }
+}
+
+}  // namespace nzl
@@ -0,0 +1,113 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      gpu_profiler.hpp
+/// @brief     Non-blocking GPU timing of frames and geometries.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+
+// mxd Library
+#include "duration.hpp"
+
+// GLFW context handle (declared here to keep GLFW out of mxd headers).
+struct GLFWwindow;
+
+namespace nzl {
+
+class Geometry;
+
+/// @brief Process-wide GPU profiler.
+///
+/// When enabled, every call to Geometry::render and every frame delimited by
+/// begin_frame() and end_frame() is bracketed by a pair of GL_TIMESTAMP
+/// queries. Timestamps (rather than GL_TIME_ELAPSED) are used because they
+/// nest, so a Scene and its members are all measured. Results are harvested
+/// only once the GPU reports them available, typically a few frames later, so
+/// profiling never stalls the pipeline.
+///
+/// Statistics are kept per OpenGL context over a rolling window of the most
+/// recent samples. Geometries are identified by address; since copies of a
+/// Geometry are distinct objects, each copy is measured separately.
+///
+/// @note Disabled by default; a disabled profiler adds no OpenGL calls.
+class GpuProfiler {
+ public:
+  /// @brief Rolling statistics of a measured quantity.
+  struct Statistics {
+    std::size_t samples{0};
+    Duration last;
+    Duration mean;
+    Duration minimum;
+    Duration maximum;
+  };
+
+  /// @brief Enable or disable profiling.
+  /// @param enabled True to enable profiling.
+  static void set_enabled(bool enabled) noexcept;
+
+  /// @brief Return whether profiling is enabled.
+  static bool is_enabled() noexcept;
+
+  /// @brief Set the number of samples kept per measured quantity.
+  /// @param window Number of samples (at least 1; 120 by default).
+  static void set_window(std::size_t window) noexcept;
+
+  /// @brief Mark the beginning of a frame in the current context.
+  static void begin_frame();
+
+  /// @brief Mark the end of a frame in the current context.
+  static void end_frame();
+
+  /// @brief Collect the results the GPU has made available, without blocking.
+  /// @note Called by begin_frame() and end_frame().
+  static void harvest();
+
+  /// @brief Return the GPU time statistics of frames in the current context.
+  static Statistics frame_statistics();
+
+  /// @brief Return the GPU time statistics of a Geometry in the current
+  /// context.
+  /// @param geometry Measured Geometry.
+  static Statistics statistics(const Geometry& geometry);
+
+  /// @brief Discard the samples of a Geometry in every context.
+  /// @param geometry Geometry being destroyed.
+  /// @note Called by the destructor of Geometry. Returns without taking a
+  /// lock if no Geometry has been measured, and scans the queries in flight
+  /// only if @p geometry has some.
+  static void forget(const Geometry& geometry) noexcept;
+
+  /// @brief Discard the queries and samples associated with a context.
+  /// @param context Context about to be destroyed.
+  static void release(GLFWwindow* context) noexcept;
+
+  /// @brief Discard every query and sample.
+  /// @note Only the queries of the current context are deleted; the others
+  /// are released with their contexts.
+  static void clear() noexcept;
+
+  /// @brief Measures the GPU time of the commands issued during its lifetime.
+  class Scope {
+   public:
+    /// @brief Start measuring a Geometry.
+    /// @param geometry Measured Geometry.
+    explicit Scope(const Geometry& geometry);
+
+    /// @brief Stop measuring.
+    ~Scope() noexcept;
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    const Geometry* m_geometry{nullptr};
+    unsigned int m_start{0};
+  };
+};
+
+}  // namespace nzl
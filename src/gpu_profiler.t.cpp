@@ -0,0 +1,139 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      gpu_profiler.t.cpp
+/// @brief     Unit tests for gpu_profiler.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "gpu_profiler.hpp"
+
+// C++ Standard Library
+#include <vector>
+
+// mxd Library
+#include "duration.hpp"
+#include "line.hpp"
+#include "mxd.hpp"
+#include "scene.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+std::vector<glm::vec3> make_points() {
+  return {{-0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}, {0.5f, -0.5f, 0.0f}};
+}
+
+}  // anonymous namespace
+
+TEST(GpuProfiler, DisabledByDefault) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  EXPECT_FALSE(nzl::GpuProfiler::is_enabled());
+
+  auto points = make_points();
+  nzl::Line line(glm::vec3(1.0f, 0.0f, 0.0f), points);
+  for (int i = 0; i < 3; i++) {
+    nzl::GpuProfiler::begin_frame();
+    line.render(nzl::TimePoint());
+    nzl::GpuProfiler::end_frame();
+  }
+  glFinish();
+  nzl::GpuProfiler::harvest();
+
+  EXPECT_EQ(nzl::GpuProfiler::frame_statistics().samples, 0u);
+  EXPECT_EQ(nzl::GpuProfiler::statistics(line).samples, 0u);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(GpuProfiler, MeasuresFramesAndGeometries) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::GpuProfiler::set_enabled(true);
+  nzl::GpuProfiler::set_window(4);
+
+  auto points = make_points();
+  nzl::Line line(glm::vec3(1.0f, 0.0f, 0.0f), points);
+  nzl::Scene scene;
+  scene.add(nzl::Line(glm::vec3(0.0f, 1.0f, 0.0f), points));
+
+  const int frames = 10;
+  for (int i = 0; i < frames; i++) {
+    nzl::GpuProfiler::begin_frame();
+    glClear(GL_COLOR_BUFFER_BIT);
+    line.render(nzl::TimePoint());
+    scene.render(nzl::TimePoint());
+    nzl::GpuProfiler::end_frame();
+    win.swap_buffers();
+  }
+
+  // Results arrive asynchronously; wait for the GPU so every one is in.
+  glFinish();
+  nzl::GpuProfiler::harvest();
+
+  auto frame = nzl::GpuProfiler::frame_statistics();
+  EXPECT_EQ(frame.samples, 4u);
+  EXPECT_GE(frame.minimum.seconds(), 0.0);
+  EXPECT_LE(frame.minimum.seconds(), frame.mean.seconds());
+  EXPECT_LE(frame.mean.seconds(), frame.maximum.seconds());
+
+  // Scenes and their members nest.
+  EXPECT_EQ(nzl::GpuProfiler::statistics(line).samples, 4u);
+  EXPECT_EQ(nzl::GpuProfiler::statistics(scene).samples, 4u);
+
+  nzl::GpuProfiler::set_enabled(false);
+  nzl::GpuProfiler::set_window(120);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(GpuProfiler, ForgetDiscardsSamples) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::GpuProfiler::set_enabled(true);
+
+  auto points = make_points();
+  nzl::Line line(glm::vec3(1.0f, 0.0f, 0.0f), points);
+  line.render(nzl::TimePoint());
+  glFinish();
+  nzl::GpuProfiler::harvest();
+  EXPECT_EQ(nzl::GpuProfiler::statistics(line).samples, 1u);
+
+  nzl::GpuProfiler::forget(line);
+  EXPECT_EQ(nzl::GpuProfiler::statistics(line).samples, 0u);
+
+  nzl::GpuProfiler::set_enabled(false);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -10,15 +10,31 @@
 #include "line.hpp"
 
 // C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 // mxd Library
+#include "duration.hpp"
+#include "frame_uniforms.hpp"
+#include "frustum.hpp"
+#include "point_view.hpp"
 #include "program.hpp"
+#include "program_cache.hpp"
+#include "render_state.hpp"
 #include "shader.hpp"
+#include "shader_library.hpp"
 #include "time_point.hpp"
-#include "utilities.hpp"
+#include "uploader.hpp"
+#include "vertex_array.hpp"
 
 // Third party libraries
 #include <GL/glew.h>
@@ -27,30 +43,292 @@
 
 namespace {  // anonymous namespace
 
-const std::string vertex_shader_source =
-    nzl::slurp(nzl::get_env_var("SHADERS_PATH") + "/simple_shader.vert");
+/// @brief Return the program of a line.
+/// @param extended Whether the line has per-vertex epochs or double-precision
+/// points, which need the trail program.
+/// @param wide Whether segments are expanded into wide capsules.
+auto make_program(bool extended = false, bool wide = false) {
+  const auto vertex = nzl::ShaderLibrary::get(
+      extended ? "line_shader.vert" : "simple_shader.vert");
+  if (wide) {
+    return nzl::ProgramCache::get(
+        {{nzl::Shader::Stage::Vertex, vertex},
+         {nzl::Shader::Stage::Geometry,
+          nzl::ShaderLibrary::get("wide_line.geom")},
+         {nzl::Shader::Stage::Fragment,
+          nzl::ShaderLibrary::get("wide_line.frag")}});
+  }
+  return nzl::ProgramCache::get(
+      {{nzl::Shader::Stage::Vertex, vertex},
+       {nzl::Shader::Stage::Fragment,
+        nzl::ShaderLibrary::get(extended ? "line_shader.frag"
+                                         : "simple_shader.frag")}});
+}
+
+/// @brief Number of regions in the ring used by streaming lines.
+const int ring_size = 3;
+
+/// @brief Block until the GPU signals @p fence, then delete it.
+void wait_and_delete(GLsync& fence) noexcept {
+  if (fence == nullptr) {
+    return;
+  }
+  auto status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+  while (status == GL_TIMEOUT_EXPIRED) {
+    status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+  }
+  glDeleteSync(fence);
+  fence = nullptr;
+}
+
+/// @brief Split @p value into the float nearest to it and the float nearest to
+/// the remainder, which together carry about 48 bits of mantissa.
+void split(const glm::dvec3& value, glm::vec3& high, glm::vec3& low) noexcept {
+  high = glm::vec3(value);
+  low = glm::vec3(value - glm::dvec3(high));
+}
+
+/// @brief Throw unless @p epochs can be loaded together with @p size points.
+void check_epochs(std::size_t size, const std::vector<nzl::TimePoint>& epochs) {
+  if (size != epochs.size()) {
+    std::ostringstream oss;
+    oss << "Cannot load " << size << " points with " << epochs.size()
+        << " epochs into a Line";
+    throw std::runtime_error(oss.str());
+  }
+  if (!std::is_sorted(epochs.begin(), epochs.end())) {
+    throw std::runtime_error("Line epochs must be in ascending order");
+  }
+}
+
+/// @brief Fill buffer @p id (generated if zero) with @p data.
+template <typename T>
+void write_buffer(unsigned int& id, const std::vector<T>& data) {
+  if (id == 0) {
+    glGenBuffers(1, &id);
+  }
+  nzl::RenderState::current().bind_buffer(GL_ARRAY_BUFFER, id);
+  glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(T), data.data(),
+               GL_STATIC_DRAW);
+}
+
+/// @brief Number of segments per chunk of a line, each culled as a whole.
+/// Also the number of vertices sharing a box in compact encodings (the
+/// vertex shader hardcodes it).
+const int chunk_size = 256;
+
+/// @brief Return the half-precision float nearest to @p value.
+std::uint16_t to_half(float value) noexcept {
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const std::uint32_t sign = (bits >> 16) & 0x8000u;
+  const std::uint32_t magnitude = bits & 0x7fffffffu;
+  if (magnitude >= 0x7f800000u) {
+    // Infinity stays infinity, and NaN stays NaN.
+    return sign | 0x7c00u | ((magnitude > 0x7f800000u) ? 0x0200u : 0u);
+  }
+  if (magnitude >= 0x477ff000u) {
+    // Rounds beyond the largest half, 65504.
+    return sign | 0x7c00u;
+  }
+  if (magnitude < 0x38800000u) {
+    // Below the smallest normal half: a multiple of 2^-24.
+    return sign | static_cast<std::uint16_t>(
+                      std::lround(std::abs(value) * 16777216.0f));
+  }
+  // Rebias the exponent (127 to 15) and round the mantissa to 10 bits, ties
+  // to even; a carry correctly bumps the exponent.
+  const std::uint32_t rebiased = magnitude - 0x38000000u;
+  return sign | static_cast<std::uint16_t>(
+                    (rebiased + 0x0fffu + ((rebiased >> 13) & 1u)) >> 13);
+}
+
+/// @brief Encode @p vertices as @p encoding, filling @p packed with three
+/// values per vertex and @p boxes with the origin and scale of every chunk.
+void encode(nzl::Line::Encoding encoding,
+            const std::vector<glm::vec3>& vertices,
+            std::vector<std::uint16_t>& packed, std::vector<float>& boxes) {
+  const int size = vertices.size();
+  packed.resize(3 * vertices.size());
+  boxes.clear();
+  for (int begin = 0; begin < size; begin += chunk_size) {
+    const int end = std::min(begin + chunk_size, size);
+    auto minimum = vertices[begin];
+    auto maximum = vertices[begin];
+    for (int k = begin + 1; k < end; ++k) {
+      minimum = glm::min(minimum, vertices[k]);
+      maximum = glm::max(maximum, vertices[k]);
+    }
+
+    // Int16 stores fractions of the box; Half stores offsets from its center
+    // in units of its half-extent, so they lie in [-1, 1] however large the
+    // chunk.
+    const bool is_int16 = (encoding == nzl::Line::Encoding::Int16);
+    const auto origin = is_int16 ? minimum : 0.5f * (minimum + maximum);
+    const auto extent = maximum - minimum;
+    const auto scale = is_int16 ? extent : 0.5f * extent;
+    boxes.insert(boxes.end(), {origin.x, origin.y, origin.z, scale.x, scale.y,
+                               scale.z});
+
+    for (int k = begin; k < end; ++k) {
+      for (int i = 0; i < 3; ++i) {
+        const float offset = vertices[k][i] - origin[i];
+        auto& value = packed[3 * k + i];
+        if (!(scale[i] > 0.0f)) {
+          value = 0;
+        } else if (is_int16) {
+          value = static_cast<std::uint16_t>(
+              std::lround(std::clamp(offset / scale[i], 0.0f, 1.0f) * 65535));
+        } else {
+          value = to_half(std::clamp(offset / scale[i], -1.0f, 1.0f));
+        }
+      }
+    }
+  }
+}
+
+/// @brief Set @p bounds to the box of the @p size vertices of a buffer, and
+/// @p chunks to the boxes of its chunks if it has more than one.
+///
+/// Chunk k holds the vertices [k chunk_size, (k + 1) chunk_size], so that it
+/// shares its last vertex with the next chunk and contains all of its
+/// segments.
+template <typename Point>
+void build_bounds(int size, Point point, nzl::Bounds& bounds,
+                  std::vector<nzl::Bounds>& chunks) {
+  bounds = nzl::Bounds();
+  chunks.clear();
+  for (int k = 0; k < size; ++k) {
+    bounds.extend(point(k));
+  }
+  if (size <= chunk_size + 1) {
+    return;
+  }
+  chunks.resize((size - 2) / chunk_size + 1);
+  for (int k = 0; k < size; ++k) {
+    const auto p = point(k);
+    if (k / chunk_size < static_cast<int>(chunks.size())) {
+      chunks[k / chunk_size].extend(p);
+    }
+    if (k > 0 && k % chunk_size == 0) {
+      chunks[k / chunk_size - 1].extend(p);
+    }
+  }
+}
+
+/// @brief Map @p bytes of the buffer bound to GL_ARRAY_BUFFER, from @p offset,
+/// for @p fill to write, and unmap them even if it throws.
+void map_and_fill(GLintptr offset, GLsizeiptr bytes, GLbitfield flags,
+                  const nzl::Line::Fill& fill) {
+  const auto access = GL_MAP_WRITE_BIT | flags;
+  auto data = glMapBufferRange(GL_ARRAY_BUFFER, offset, bytes, access);
+  if (data == nullptr) {
+    std::ostringstream oss;
+    oss << "Cannot map " << bytes << " bytes of the vertex buffer of a Line";
+    throw std::runtime_error(oss.str());
+  }
+  try {
+    fill(static_cast<glm::vec3*>(data));
+  } catch (...) {
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    throw;
+  }
+  glUnmapBuffer(GL_ARRAY_BUFFER);
+}
 
-const std::string fragment_shader_source =
-    nzl::slurp(nzl::get_env_var("SHADERS_PATH") + "/simple_shader.frag");
+/// @brief Lines with fewer points are always drawn at full resolution.
+const int lod_minimum_points = 4096;
 
-/// @TODO This is too ugly. Program needs a full refactoring.
-auto make_program() {
-  /// @TODO The Shader/Program interface feels very awkward. For instance: why
-  /// do I need to pass a vector of shaders? Why do I need to compile the
-  /// shaders and then compile the program? Shouldn't the program compile the
-  /// shaders if it needs to? What happens if I forget to compile the shader?
-  std::vector<nzl::Shader> shaders;
-  shaders.emplace_back(nzl::Shader::Stage::Vertex, vertex_shader_source);
-  shaders.emplace_back(nzl::Shader::Stage::Fragment, fragment_shader_source);
-  for (auto& shader : shaders) {
-    shader.compile();
+/// @brief Return about how many pixels one unit spans at the point of @p box
+/// closest to the eye, once mapped to clip space by @p clip.
+/// @param viewport Viewport size, in pixels.
+float projected_scale(const glm::dmat4& clip, const nzl::Bounds& box,
+                      const glm::vec2& viewport) noexcept {
+  // Clip x and y grow by at most the length of their rows per unit, and are
+  // divided by w, which is smallest at a corner of the box.
+  const auto row = [&clip](int r) {
+    return glm::dvec4(clip[0][r], clip[1][r], clip[2][r], clip[3][r]);
+  };
+  const auto growth = [&row](int r) {
+    return glm::length(glm::dvec3(row(r)));
+  };
+  double w = 1.0;
+  if (!box.is_empty()) {
+    w = std::numeric_limits<double>::infinity();
+    for (int corner = 0; corner < 8; ++corner) {
+      const glm::dvec4 p((corner & 1) ? box.maximum[0] : box.minimum[0],
+                         (corner & 2) ? box.maximum[1] : box.minimum[1],
+                         (corner & 4) ? box.maximum[2] : box.minimum[2], 1.0);
+      w = std::min(w, glm::dot(row(3), p));
+    }
   }
 
-  nzl::Program program(shaders);
-  program.compile();
+  // A box reaching the eye is drawn at full resolution.
+  const double pixels =
+      0.5 * std::max(viewport.x * growth(0), viewport.y * growth(1));
+  return static_cast<float>(pixels / std::max(w, 1.0e-9));
+}
 
-  return program;
+/// @brief Return the distance from @p p to the segment [@p a, @p b].
+float distance_to_segment(const glm::vec3& p, const glm::vec3& a,
+                          const glm::vec3& b) noexcept {
+  const auto ab = b - a;
+  const auto length2 = glm::dot(ab, ab);
+  if (length2 == 0.0f) {
+    return glm::length(p - a);
+  }
+  const auto s = std::clamp(glm::dot(p - a, ab) / length2, 0.0f, 1.0f);
+  return glm::length(p - (a + s * ab));
 }
+
+/// @brief Return, for every point, the largest Douglas-Peucker tolerance at
+/// which the point is kept.
+///
+/// A single pass of the algorithm yields every level at once: a point is kept
+/// at tolerance e if and only if its significance exceeds e. Significances are
+/// capped by those of the enclosing split, so levels are nested.
+std::vector<float> significance(const glm::vec3* points, int size) {
+  const float infinity = std::numeric_limits<float>::infinity();
+  std::vector<float> result(size, 0.0f);
+  if (size == 0) {
+    return result;
+  }
+  result.front() = infinity;
+  result.back() = infinity;
+
+  // An explicit stack, since millions of points would exhaust the call stack.
+  struct Span {
+    int first;
+    int last;
+    float bound;
+  };
+  std::vector<Span> stack{{0, size - 1, infinity}};
+  while (!stack.empty()) {
+    const auto span = stack.back();
+    stack.pop_back();
+    if (span.last - span.first < 2) {
+      continue;
+    }
+
+    int farthest = span.first + 1;
+    float distance = -1.0f;
+    for (int k = span.first + 1; k < span.last; ++k) {
+      const auto d = distance_to_segment(points[k], points[span.first],
+                                         points[span.last]);
+      if (d > distance) {
+        distance = d;
+        farthest = k;
+      }
+    }
+
+    const auto bound = std::min(distance, span.bound);
+    result[farthest] = bound;
+    stack.push_back({span.first, farthest, bound});
+    stack.push_back({farthest, span.last, bound});
+  }
+  return result;
+}
+
 }  // anonymous namespace
 
 namespace nzl {
@@ -60,41 +338,684 @@ struct nzl::Line::LineImp {
   LineImp();
   ~LineImp() noexcept;
   nzl::Program program;  /// @TODO Why not provide a default constructor?
-  unsigned int vao_id;
+  /// Revision of the program when its uniforms were looked up.
+  unsigned int program_revision{0};
+  nzl::UniformHandle<glm::vec3> color_uniform;
+  nzl::VertexArray vertex_array;
   unsigned int vbo_id;
+  unsigned int epoch_vbo_id{0};
+  unsigned int low_vbo_id{0};
   int number_of_points{0};
+  int first_point{0};
   glm::vec3 color;
 
-  void load_points(glm::vec3 points[], int size);
+  /// @brief A level of the decimation pyramid: a range of the vertex buffer
+  /// that stays within @p tolerance of the full-resolution line.
+  struct Level {
+    int first;
+    int count;
+    float tolerance;
+  };
+
+  /// @brief Points prepared for the GPU: every level of detail, split into
+  /// high and low parts if in double precision, and with epochs if timed.
+  ///
+  /// Staging touches no OpenGL state, so an Uploader may stage on its worker
+  /// thread, and also fill buffers of the staged points' own (see
+  /// create_buffers) for the line to adopt once they are complete.
+  struct Staged {
+    std::vector<Level> levels;
+    std::vector<glm::vec3> vertices;
+    std::vector<glm::vec3> low_parts;
+    std::vector<double> epochs;
+    std::vector<float> offsets;
+    double reference_epoch{0.0};
+    nzl::Bounds bounds;
+    std::vector<nzl::Bounds> chunks;
+    Line::Encoding encoding{Line::Encoding::Float};
+    std::vector<std::uint16_t> packed;
+    std::vector<float> boxes;
+    bool is_precise{false};
+    bool is_timed{false};
+    unsigned int vbo_id{0};
+    unsigned int low_vbo_id{0};
+    unsigned int epoch_vbo_id{0};
+    unsigned int box_vbo_id{0};
+
+    Staged() = default;
+    Staged(const Staged&) = delete;
+    Staged& operator=(const Staged&) = delete;
+    ~Staged() noexcept;
+
+    void create_buffers();
+    void write_vertices(unsigned int& id, unsigned int& boxes_id) const;
+    std::size_t vertex_buffer_size() const noexcept;
+  };
+
+  /// Levels from finest (the loaded points) to coarsest.
+  std::vector<Level> levels;
+  float pixel_scale{0.0f};
+  float lod_tolerance{0.5f};
+  int rendered_points{0};
+
+  /// Culling state: the box of every vertex of the buffer, and of each chunk
+  /// of it (see build_bounds). The ranges of the last draw are kept to reuse
+  /// their storage.
+  nzl::Bounds bounds;
+  bool bounds_are_known{true};
+  std::vector<nzl::Bounds> chunks;
+  std::vector<GLint> draw_firsts;
+  std::vector<GLsizei> draw_counts;
+
+  /// Trail state (see Line::set_trail_length). Epochs are in seconds past
+  /// J2000, one per vertex of the buffer; the GPU receives them relative to
+  /// the first one so they fit in single precision.
+  std::vector<double> epochs;
+  double reference_epoch{0.0};
+  nzl::Duration trail_length;
+  bool fade{false};
+  nzl::UniformHandle<float> time_uniform;
+  nzl::UniformHandle<float> trail_length_uniform;
+
+  /// Double-precision state (see Line::set_eye). The vertex buffer holds the
+  /// high part of every point and a second buffer the low part.
+  bool is_precise{false};
+  glm::dvec3 eye{0.0, 0.0, 0.0};
+  glm::mat4 transform{1.0f};
+  nzl::UniformHandle<glm::vec3> eye_high_uniform;
+  nzl::UniformHandle<glm::vec3> eye_low_uniform;
+  nzl::UniformHandle<glm::mat4> transform_uniform;
+  nzl::UniformHandle<bool> relative_to_eye_uniform;
+
+  /// Compact encodings (see Line::set_encoding). The boxes of the chunks of
+  /// the loaded vertices are read through a buffer texture.
+  Line::Encoding encoding{Line::Encoding::Float};
+  Line::Encoding loaded_encoding{Line::Encoding::Float};
+  std::size_t vertex_buffer_size{0};
+  unsigned int box_vbo_id{0};
+  unsigned int box_texture_id{0};
+  nzl::UniformHandle<bool> quantized_uniform;
+  nzl::UniformHandle<int> chunk_boxes_uniform;
+
+  /// Whether the program is the trail program (epochs, double precision, or
+  /// a compact encoding).
+  bool is_extended{false};
+
+  /// Width in pixels (see Line::set_width), and whether the program expands
+  /// segments to it.
+  float width{1.0f};
+  bool is_wide{false};
+  nzl::UniformHandle<float> width_uniform;
+
+  /// Streaming mode state (see Line::enable_streaming).
+  bool streaming{false};
+  int ring_capacity{0};
+  int ring_index{0};
+  void* ring_data{nullptr};
+  GLsync ring_fences[ring_size]{};
+
+  /// Points being uploaded by an Uploader (see Line::load_points).
+  std::shared_ptr<Staged> pending;
+  Uploader::Ticket pending_ticket;
+
+  void load_points(const glm::vec3* points, int size,
+                   const TimePoint* point_epochs = nullptr);
+  void load_points(const glm::dvec3* points, int size,
+                   const TimePoint* point_epochs);
+  Uploader::Ticket load_points(Uploader& uploader,
+                               std::vector<glm::vec3> points,
+                               std::vector<glm::dvec3> precise_points,
+                               std::vector<TimePoint> point_epochs);
+  void load(Staged& staged);
+  void adopt(Staged& staged);
+  void apply(Staged& staged);
+  void adopt_pending();
+  void set_program(bool extended, bool wide);
+  void find_uniforms();
+  static void stage(Staged& staged, const glm::vec3* points,
+                    const glm::dvec3* precise_points, int size,
+                    const TimePoint* point_epochs, Line::Encoding encoding);
+  static std::vector<int> build_levels(const glm::vec3* points, int size,
+                                       std::vector<Level>& levels);
+  const Level& select_level() const;
+  void find_visible(int first, int count);
+  void layout();
+  void create_ring(int capacity);
+  void stream(int size, const Line::Fill& fill);
+  void stream_points(const PointView& points);
+  void fill(int size, const Line::Fill& fill);
 };
 
-nzl::Line::LineImp::LineImp() : program{make_program()} {
+nzl::Line::LineImp::LineImp()
+    : program{make_program()},
+      program_revision{program.revision()},
+      color_uniform{program.uniform<glm::vec3>("color")},
+      vertex_array{[this] { layout(); }} {
   /// @TODO Add error checking! 10 minutes spent adding good error checking and
   /// error messages will save you 10 hours debugging the program in the future.
-  glGenVertexArrays(1, &vao_id);
-  glBindVertexArray(vao_id);
+  auto& state = RenderState::current();
   glGenBuffers(1, &vbo_id);
-  glBindBuffer(GL_ARRAY_BUFFER, vbo_id);
+  state.bind_buffer(GL_ARRAY_BUFFER, vbo_id);
   glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_STATIC_DRAW);
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-  glDisableVertexAttribArray(0);
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-  glBindVertexArray(0);
 }
 
 nzl::Line::LineImp::~LineImp() noexcept {
   /// @TODO: Add error checking!
-  glDeleteVertexArrays(1, &vao_id);
+  for (auto&& fence : ring_fences) {
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+    }
+  }
+  auto& state = RenderState::current();
+  state.forget_buffer(vbo_id);
+  state.forget_buffer(epoch_vbo_id);
+  state.forget_buffer(low_vbo_id);
+  state.forget_buffer(box_vbo_id);
   glDeleteBuffers(1, &vbo_id);
+  glDeleteBuffers(1, &epoch_vbo_id);
+  glDeleteBuffers(1, &low_vbo_id);
+  glDeleteBuffers(1, &box_vbo_id);
+  glDeleteTextures(1, &box_texture_id);
+}
+
+nzl::Line::LineImp::Staged::~Staged() noexcept {
+  auto& state = RenderState::current();
+  for (auto id : {vbo_id, low_vbo_id, epoch_vbo_id, box_vbo_id}) {
+    if (id != 0) {
+      state.forget_buffer(id);
+      glDeleteBuffers(1, &id);
+    }
+  }
 }
 
-void nzl::Line::LineImp::load_points(glm::vec3 points[], int size) {
+void nzl::Line::LineImp::Staged::create_buffers() {
+  write_vertices(vbo_id, box_vbo_id);
+  if (is_precise) {
+    write_buffer(low_vbo_id, low_parts);
+  }
+  if (is_timed) {
+    write_buffer(epoch_vbo_id, offsets);
+  }
+}
+
+void nzl::Line::LineImp::Staged::write_vertices(
+    unsigned int& id, unsigned int& boxes_id) const {
+  if (encoding == Line::Encoding::Float) {
+    write_buffer(id, vertices);
+  } else {
+    write_buffer(id, packed);
+    write_buffer(boxes_id, boxes);
+  }
+}
+
+std::size_t nzl::Line::LineImp::Staged::vertex_buffer_size() const noexcept {
+  return (encoding == Line::Encoding::Float)
+             ? vertices.size() * sizeof(glm::vec3)
+             : packed.size() * sizeof(std::uint16_t);
+}
+
+void nzl::Line::LineImp::load_points(const glm::vec3* points, int size,
+                                     const TimePoint* point_epochs) {
+  pending.reset();
+  if (streaming) {
+    return stream_points(
+        PointView(reinterpret_cast<const float*>(points), size));
+  }
+  Staged staged;
+  stage(staged, points, nullptr, size, point_epochs, encoding);
+  load(staged);
+}
+
+void nzl::Line::LineImp::load_points(const glm::dvec3* points, int size,
+                                     const TimePoint* point_epochs) {
+  pending.reset();
+  Staged staged;
+  stage(staged, nullptr, points, size, point_epochs, Line::Encoding::Float);
+  load(staged);
+}
+
+nzl::Uploader::Ticket nzl::Line::LineImp::load_points(
+    Uploader& uploader, std::vector<glm::vec3> points,
+    std::vector<glm::dvec3> precise_points,
+    std::vector<TimePoint> point_epochs) {
+  const bool is_timed = !point_epochs.empty();
+  const bool wide = is_wide;
+  const auto points_encoding =
+      precise_points.empty() ? encoding : Line::Encoding::Float;
+  auto staged = std::make_shared<Staged>();
+  auto ticket = uploader.submit([=, points = std::move(points),
+                                 precise_points = std::move(precise_points),
+                                 point_epochs = std::move(point_epochs)] {
+    const auto epochs = is_timed ? point_epochs.data() : nullptr;
+    if (precise_points.empty()) {
+      stage(*staged, points.data(), nullptr, points.size(), epochs,
+            points_encoding);
+    } else {
+      stage(*staged, nullptr, precise_points.data(), precise_points.size(),
+            epochs, points_encoding);
+    }
+    staged->create_buffers();
+
+    // Link the program the line switches to, so adopting is a cache hit.
+    make_program(staged->is_precise || staged->is_timed ||
+                     staged->encoding != Line::Encoding::Float,
+                 wide);
+  });
+
+  pending = staged;
+  pending_ticket = ticket;
+  return ticket;
+}
+
+void nzl::Line::LineImp::stage(Staged& staged, const glm::vec3* points,
+                               const glm::dvec3* precise_points, int size,
+                               const TimePoint* point_epochs,
+                               Line::Encoding encoding) {
+  // Decimation only needs single precision relative to the line itself.
+  std::vector<glm::vec3> relative;
+  if (precise_points != nullptr) {
+    relative.reserve(size);
+    for (int k = 0; k < size; ++k) {
+      relative.emplace_back(precise_points[k] - precise_points[0]);
+    }
+    points = relative.data();
+  }
+  const auto indices = build_levels(points, size, staged.levels);
+
+  // Every vertex of the buffer (all levels of detail) is a loaded point.
+  staged.is_precise = (precise_points != nullptr);
+  staged.vertices.resize(indices.size());
+  staged.low_parts.resize(staged.is_precise ? indices.size() : 0);
+  for (std::size_t k = 0; k < indices.size(); ++k) {
+    if (staged.is_precise) {
+      split(precise_points[indices[k]], staged.vertices[k],
+            staged.low_parts[k]);
+    } else {
+      staged.vertices[k] = points[indices[k]];
+    }
+  }
+
+  if (staged.is_precise) {
+    build_bounds(
+        indices.size(), [&](int k) { return precise_points[indices[k]]; },
+        staged.bounds, staged.chunks);
+  } else {
+    build_bounds(
+        indices.size(), [&](int k) { return glm::dvec3(staged.vertices[k]); },
+        staged.bounds, staged.chunks);
+  }
+
+  staged.encoding = encoding;
+  if (encoding != Line::Encoding::Float) {
+    encode(encoding, staged.vertices, staged.packed, staged.boxes);
+    staged.vertices = {};
+  }
+
+  staged.is_timed = (point_epochs != nullptr);
+  if (!staged.is_timed) {
+    return;
+  }
+  staged.reference_epoch =
+      indices.empty() ? 0.0 : point_epochs[0].elapsed().seconds();
+  staged.epochs.reserve(indices.size());
+  staged.offsets.reserve(indices.size());
+  for (auto&& index : indices) {
+    staged.epochs.push_back(point_epochs[index].elapsed().seconds());
+    staged.offsets.push_back(
+        static_cast<float>(staged.epochs.back() - staged.reference_epoch));
+  }
+}
+
+void nzl::Line::LineImp::load(Staged& staged) {
+  staged.write_vertices(vbo_id, box_vbo_id);
+  if (staged.is_precise) {
+    write_buffer(low_vbo_id, staged.low_parts);
+  }
+  if (staged.is_timed) {
+    write_buffer(epoch_vbo_id, staged.offsets);
+  }
+  apply(staged);
+}
+
+void nzl::Line::LineImp::adopt(Staged& staged) {
+  // The staged points take over the buffers they were uploaded to, and
+  // delete the replaced ones.
+  std::swap(vbo_id, staged.vbo_id);
+  if (staged.encoding != Line::Encoding::Float) {
+    std::swap(box_vbo_id, staged.box_vbo_id);
+  }
+  if (staged.is_precise) {
+    std::swap(low_vbo_id, staged.low_vbo_id);
+  }
+  if (staged.is_timed) {
+    std::swap(epoch_vbo_id, staged.epoch_vbo_id);
+  }
+  apply(staged);
+}
+
+void nzl::Line::LineImp::apply(Staged& staged) {
+  levels = std::move(staged.levels);
+  number_of_points = levels.front().count;
+  epochs = std::move(staged.epochs);
+  reference_epoch = staged.reference_epoch;
+  bounds = staged.bounds;
+  bounds_are_known = true;
+  chunks = std::move(staged.chunks);
+  is_precise = staged.is_precise;
+  loaded_encoding = staged.encoding;
+  vertex_buffer_size = staged.vertex_buffer_size();
+  if (loaded_encoding != Line::Encoding::Float) {
+    // The texture reads the box buffer as it is when attached.
+    if (box_texture_id == 0) {
+      glGenTextures(1, &box_texture_id);
+    }
+    glBindTexture(GL_TEXTURE_BUFFER, box_texture_id);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGB32F, box_vbo_id);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+  }
+  set_program(staged.is_precise || staged.is_timed ||
+                  loaded_encoding != Line::Encoding::Float,
+              is_wide);
+  vertex_array.update();
+}
+
+void nzl::Line::LineImp::adopt_pending() {
+  if (pending && pending_ticket.is_ready()) {
+    adopt(*pending);
+    pending.reset();
+    pending_ticket = {};
+  }
+}
+
+void nzl::Line::LineImp::set_program(bool extended, bool wide) {
+  if (extended == is_extended && wide == is_wide) {
+    return;
+  }
+  is_extended = extended;
+  is_wide = wide;
+
+  program = make_program(extended, wide);
+  find_uniforms();
+}
+
+void nzl::Line::LineImp::find_uniforms() {
+  program_revision = program.revision();
+  color_uniform = program.uniform<glm::vec3>("color");
+  width_uniform = {};
+  if (is_wide) {
+    width_uniform = program.uniform<float>("width");
+  }
+  time_uniform = {};
+  trail_length_uniform = {};
+  eye_high_uniform = {};
+  eye_low_uniform = {};
+  transform_uniform = {};
+  relative_to_eye_uniform = {};
+  quantized_uniform = {};
+  chunk_boxes_uniform = {};
+  if (is_extended) {
+    time_uniform = program.uniform<float>("time");
+    trail_length_uniform = program.uniform<float>("trail_length");
+    eye_high_uniform = program.uniform<glm::vec3>("eye_high");
+    eye_low_uniform = program.uniform<glm::vec3>("eye_low");
+    transform_uniform = program.uniform<glm::mat4>("transform");
+    relative_to_eye_uniform = program.uniform<bool>("is_relative_to_eye");
+    quantized_uniform = program.uniform<bool>("is_quantized");
+    chunk_boxes_uniform = program.uniform<int>("chunk_boxes");
+  }
+}
+
+std::vector<int> nzl::Line::LineImp::build_levels(const glm::vec3* points,
+                                                  int size,
+                                                  std::vector<Level>& levels) {
+  std::vector<int> indices(size);
+  for (int k = 0; k < size; ++k) {
+    indices[k] = k;
+  }
+  levels = {{0, size, 0.0f}};
+  if (size < lod_minimum_points) {
+    return indices;
+  }
+
+  const auto kept_at = significance(points, size);
+  auto sorted = kept_at;
+  std::sort(sorted.begin(), sorted.end());
+
+  glm::vec3 lower = points[0];
+  glm::vec3 upper = points[0];
+  for (int k = 1; k < size; ++k) {
+    lower = glm::min(lower, points[k]);
+    upper = glm::max(upper, points[k]);
+  }
+  const auto extent = glm::length(upper - lower);
+
+  // Tolerances double from a millionth of the extent. A level is kept only if
+  // it halves the previous one, so the pyramid is at most twice the size of
+  // the line.
+  for (auto tolerance = extent * 1.0e-6f; tolerance < extent;
+       tolerance *= 2.0f) {
+    const auto count = static_cast<int>(
+        sorted.end() -
+        std::upper_bound(sorted.begin(), sorted.end(), tolerance));
+    if (count < 2) {
+      break;
+    }
+    if (count > levels.back().count / 2) {
+      continue;
+    }
+    levels.push_back({static_cast<int>(indices.size()), count, tolerance});
+    for (int k = 0; k < size; ++k) {
+      if (kept_at[k] > tolerance) {
+        indices.push_back(k);
+      }
+    }
+  }
+  return indices;
+}
+
+const nzl::Line::LineImp::Level& nzl::Line::LineImp::select_level() const {
+  auto scale = pixel_scale;
+  if (scale <= 0.0f) {
+    // Project the bounds once per frame, as find_visible does: by their own
+    // transform relative to the eye, or else by the camera of the frame.
+    const auto viewport = FrameUniforms::viewport();
+    scale = is_precise ? projected_scale(glm::dmat4(transform),
+                                         bounds.translated(-eye), viewport)
+                       : projected_scale(
+                             glm::dmat4(FrameUniforms::view_projection()),
+                             bounds, viewport);
+  }
+
+  // The coarsest level whose error stays below the tolerance on screen.
+  for (auto it = levels.rbegin(); it != levels.rend(); ++it) {
+    if (it->tolerance * scale <= lod_tolerance) {
+      return *it;
+    }
+  }
+  return levels.front();
+}
+
+void nzl::Line::LineImp::find_visible(int first, int count) {
+  draw_firsts.clear();
+  draw_counts.clear();
+
+  // Double-precision points are drawn relative to the eye, by their own
+  // transform; every other line by the camera of the frame.
+  const auto frustum =
+      is_precise ? Frustum(glm::dmat4(transform)) : FrameUniforms::frustum();
+  const auto offset = is_precise ? -eye : glm::dvec3(0.0);
+  const auto visible = [&](const Bounds& box) {
+    return frustum.intersects(box.translated(offset));
+  };
+
+  if (count < 2 || chunks.empty()) {
+    // Geometry::render already culled lines with known bounds.
+    if (count > 0 && (!is_precise || visible(bounds))) {
+      draw_firsts.push_back(first);
+      draw_counts.push_back(count);
+    }
+    return;
+  }
+
+  // Draw every run of consecutive visible chunks as a single strip. The
+  // chunk of a segment is that of its first vertex.
+  const int end = first + count;
+  for (int k = first / chunk_size; k <= (end - 2) / chunk_size; ++k) {
+    if (!visible(chunks[k])) {
+      continue;
+    }
+    const int begin = std::max(first, k * chunk_size);
+    const int stop = std::min(end, (k + 1) * chunk_size + 1);
+    if (!draw_firsts.empty() &&
+        draw_firsts.back() + draw_counts.back() == begin + 1) {
+      draw_counts.back() = stop - draw_firsts.back();
+    } else {
+      draw_firsts.push_back(begin);
+      draw_counts.push_back(stop - begin);
+    }
+  }
+}
+
+void nzl::Line::LineImp::layout() {
+  // Attributes 1 (epochs) and 2 (low parts) are enabled only when loaded;
+  // disabled attributes read as zero, which the trail program ignores.
+  auto& state = RenderState::current();
+  state.bind_buffer(GL_ARRAY_BUFFER, vbo_id);
+  switch (loaded_encoding) {
+    case Line::Encoding::Float:
+      glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float),
+                            (void*)0);
+      break;
+    case Line::Encoding::Half:
+      glVertexAttribPointer(0, 3, GL_HALF_FLOAT, GL_FALSE,
+                            3 * sizeof(std::uint16_t), (void*)0);
+      break;
+    case Line::Encoding::Int16:
+      glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE,
+                            3 * sizeof(std::uint16_t), (void*)0);
+      break;
+  }
+  glEnableVertexAttribArray(0);
+
+  if (!epochs.empty()) {
+    state.bind_buffer(GL_ARRAY_BUFFER, epoch_vbo_id);
+    glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)0);
+    glEnableVertexAttribArray(1);
+  } else {
+    glDisableVertexAttribArray(1);
+  }
+
+  if (is_precise) {
+    state.bind_buffer(GL_ARRAY_BUFFER, low_vbo_id);
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float),
+                          (void*)0);
+    glEnableVertexAttribArray(2);
+  } else {
+    glDisableVertexAttribArray(2);
+  }
+}
+
+void nzl::Line::LineImp::create_ring(int capacity) {
+  // The GPU may still be drawing from the old ring; deleting the buffer is
+  // safe (GL defers it), but the fences belong to the old ring.
+  for (auto&& fence : ring_fences) {
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+  auto& state = RenderState::current();
+  state.forget_buffer(vbo_id);
+  glDeleteBuffers(1, &vbo_id);
+  glGenBuffers(1, &vbo_id);
+
+  ring_capacity = capacity;
+  ring_index = 0;
+  ring_data = nullptr;
+  const GLsizeiptr bytes = ring_size * capacity * 3 * sizeof(float);
+  vertex_buffer_size = bytes;
+
+  state.bind_buffer(GL_ARRAY_BUFFER, vbo_id);
+  if (GLEW_ARB_buffer_storage) {
+    const GLbitfield flags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glBufferStorage(GL_ARRAY_BUFFER, bytes, nullptr, flags);
+    ring_data = glMapBufferRange(GL_ARRAY_BUFFER, 0, bytes, flags);
+  } else {
+    glBufferData(GL_ARRAY_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+  }
+
+  vertex_array.update();
+}
+
+void nzl::Line::LineImp::stream(int size, const Line::Fill& fill) {
+  if (size > ring_capacity) {
+    create_ring(size);
+  }
+
+  const int index = (ring_index + 1) % ring_size;
+  wait_and_delete(ring_fences[index]);
+
+  const GLintptr offset = index * ring_capacity * 3 * sizeof(float);
+  const GLsizeiptr bytes = size * 3 * sizeof(float);
+  if (ring_data != nullptr) {
+    fill(reinterpret_cast<glm::vec3*>(static_cast<char*>(ring_data) + offset));
+  } else if (bytes > 0) {
+    // Without persistent mapping, the fence above already guarantees the
+    // region is idle, so an unsynchronized map avoids the implicit stall.
+    RenderState::current().bind_buffer(GL_ARRAY_BUFFER, vbo_id);
+    map_and_fill(offset, bytes,
+                 GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT,
+                 fill);
+  }
+
+  // Only a complete region replaces the one drawn so far.
+  ring_index = index;
+  first_point = ring_index * ring_capacity;
+  number_of_points = size;
+}
+
+void nzl::Line::LineImp::stream_points(const PointView& points) {
+  const int size = points.size();
+  stream(size, [&](glm::vec3* output) { points.copy(output); });
+
+  // Streamed points change every frame; only the whole line is culled.
+  bounds = Bounds();
+  for (int k = 0; k < size; ++k) {
+    bounds.extend(glm::dvec3(points[k]));
+  }
+  bounds_are_known = true;
+}
+
+void nzl::Line::LineImp::fill(int size, const Line::Fill& fill) {
+  pending.reset();
+  bounds_are_known = false;
+  if (streaming) {
+    return stream(size, fill);
+  }
+
+  // Orphan the storage, so the GPU may keep drawing the old points.
+  const GLsizeiptr bytes = size * sizeof(glm::vec3);
+  RenderState::current().bind_buffer(GL_ARRAY_BUFFER, vbo_id);
+  glBufferData(GL_ARRAY_BUFFER, bytes, nullptr, GL_STATIC_DRAW);
+
+  // The points are never read back, so the line has a single level of
+  // detail, no epochs, and no bounds.
+  levels = {{0, 0, 0.0f}};
+  number_of_points = 0;
+  epochs.clear();
+  chunks.clear();
+  is_precise = false;
+  loaded_encoding = Line::Encoding::Float;
+  vertex_buffer_size = bytes;
+  set_program(false, is_wide);
+  vertex_array.update();
+
+  if (bytes > 0) {
+    map_and_fill(0, bytes, GL_MAP_INVALIDATE_BUFFER_BIT, fill);
+  }
+  levels.front().count = size;
   number_of_points = size;
-  glBindBuffer(GL_ARRAY_BUFFER, vbo_id);
-  glBufferData(GL_ARRAY_BUFFER, size * 3 * sizeof(float), points,
-               GL_STATIC_DRAW);
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 // -----------------------------------------------------------------------------
@@ -111,14 +1032,173 @@ Line::Line(glm::vec3 color, std::vector<glm::vec3>& points) : Line(color) {
   load_points(points);
 }
 
-void Line::load_points(std::vector<glm::vec3>& points) noexcept {
+void Line::load_points(std::vector<glm::vec3>& points) {
   m_pimpl->load_points(points.data(), points.size());
 }
 
-void Line::load_points(glm::vec3 points[], int size) noexcept {
+void Line::load_points(glm::vec3 points[], int size) {
   m_pimpl->load_points(points, size);
 }
 
+void Line::load_points(const PointView& points) {
+  if (auto data = points.data()) {
+    return m_pimpl->load_points(data, points.size());
+  }
+  if (m_pimpl->streaming) {
+    // Converted straight into the ring.
+    m_pimpl->pending.reset();
+    return m_pimpl->stream_points(points);
+  }
+
+  // Decimation and bounds read the points, so they are converted once.
+  std::vector<glm::vec3> converted(points.size());
+  points.copy(converted.data());
+  m_pimpl->load_points(converted.data(), converted.size());
+}
+
+void Line::fill_points(int size, const Fill& fill) {
+  m_pimpl->fill(std::max(size, 0), fill);
+}
+
+void Line::load_points(std::vector<glm::vec3>& points,
+                       const std::vector<TimePoint>& epochs) {
+  if (m_pimpl->streaming) {
+    throw std::runtime_error("Cannot load epochs into a streaming Line");
+  }
+  check_epochs(points.size(), epochs);
+  m_pimpl->load_points(points.data(), points.size(), epochs.data());
+}
+
+void Line::load_points(const std::vector<glm::dvec3>& points) {
+  if (m_pimpl->streaming) {
+    throw std::runtime_error(
+        "Cannot load double-precision points into a streaming Line");
+  }
+  m_pimpl->load_points(points.data(), points.size(), nullptr);
+}
+
+void Line::load_points(const std::vector<glm::dvec3>& points,
+                       const std::vector<TimePoint>& epochs) {
+  if (m_pimpl->streaming) {
+    throw std::runtime_error(
+        "Cannot load double-precision points into a streaming Line");
+  }
+  check_epochs(points.size(), epochs);
+  m_pimpl->load_points(points.data(), points.size(), epochs.data());
+}
+
+Uploader::Ticket Line::load_points(Uploader& uploader,
+                                   std::vector<glm::vec3> points,
+                                   std::vector<TimePoint> epochs) {
+  if (m_pimpl->streaming) {
+    throw std::runtime_error(
+        "Cannot load points through an Uploader into a streaming Line");
+  }
+  if (!epochs.empty()) {
+    check_epochs(points.size(), epochs);
+  }
+  return m_pimpl->load_points(uploader, std::move(points), {},
+                              std::move(epochs));
+}
+
+Uploader::Ticket Line::load_points(Uploader& uploader,
+                                   std::vector<glm::dvec3> points,
+                                   std::vector<TimePoint> epochs) {
+  if (m_pimpl->streaming) {
+    throw std::runtime_error(
+        "Cannot load points through an Uploader into a streaming Line");
+  }
+  if (!epochs.empty()) {
+    check_epochs(points.size(), epochs);
+  }
+  return m_pimpl->load_points(uploader, {}, std::move(points),
+                              std::move(epochs));
+}
+
+bool Line::is_loading() const noexcept { return m_pimpl->pending != nullptr; }
+
+void Line::set_encoding(Encoding encoding) noexcept {
+  m_pimpl->encoding = encoding;
+}
+
+Line::Encoding Line::encoding() const noexcept { return m_pimpl->encoding; }
+
+std::size_t Line::vertex_buffer_size() const noexcept {
+  return m_pimpl->vertex_buffer_size;
+}
+
+bool Line::is_double_precision() const noexcept {
+  return m_pimpl->is_precise;
+}
+
+void Line::set_eye(const glm::dvec3& eye) noexcept { m_pimpl->eye = eye; }
+
+glm::dvec3 Line::eye() const noexcept { return m_pimpl->eye; }
+
+void Line::set_transform(const glm::mat4& transform) noexcept {
+  m_pimpl->transform = transform;
+}
+
+glm::mat4 Line::transform() const noexcept { return m_pimpl->transform; }
+
+bool Line::has_epochs() const noexcept { return !m_pimpl->epochs.empty(); }
+
+void Line::set_trail_length(Duration trail_length) noexcept {
+  m_pimpl->trail_length = trail_length;
+}
+
+Duration Line::trail_length() const noexcept { return m_pimpl->trail_length; }
+
+void Line::set_fade(bool fade) noexcept { m_pimpl->fade = fade; }
+
+bool Line::fade() const noexcept { return m_pimpl->fade; }
+
+void Line::enable_streaming(int capacity) {
+  if (!m_pimpl->streaming) {
+    m_pimpl->streaming = true;
+    m_pimpl->pending.reset();
+    m_pimpl->create_ring(std::max(capacity, 1));
+    m_pimpl->number_of_points = 0;
+    m_pimpl->levels.clear();
+    m_pimpl->epochs.clear();
+    m_pimpl->bounds = Bounds();
+    m_pimpl->chunks.clear();
+    m_pimpl->is_precise = false;
+    m_pimpl->loaded_encoding = Encoding::Float;
+    m_pimpl->set_program(false, m_pimpl->is_wide);
+    m_pimpl->vertex_array.update();
+  }
+}
+
+bool Line::is_streaming() const noexcept { return m_pimpl->streaming; }
+
+void Line::set_pixel_scale(float pixels_per_unit) noexcept {
+  m_pimpl->pixel_scale = pixels_per_unit;
+}
+
+float Line::pixel_scale() const noexcept { return m_pimpl->pixel_scale; }
+
+void Line::set_lod_tolerance(float pixels) noexcept {
+  m_pimpl->lod_tolerance = pixels;
+}
+
+float Line::lod_tolerance() const noexcept { return m_pimpl->lod_tolerance; }
+
+int Line::number_of_levels() const noexcept {
+  return static_cast<int>(m_pimpl->levels.size());
+}
+
+int Line::rendered_points() const noexcept {
+  return m_pimpl->rendered_points;
+}
+
+void Line::set_width(float pixels) {
+  m_pimpl->width = pixels;
+  m_pimpl->set_program(m_pimpl->is_extended, pixels > 1.0f);
+}
+
+float Line::width() const noexcept { return m_pimpl->width; }
+
 glm::vec3 Line::color() const noexcept { return m_pimpl->color; }
 
 void Line::set_color(glm::vec3 color) noexcept { m_pimpl->color = color; }
@@ -127,19 +1207,141 @@ const nzl::Program& Line::get_program() const noexcept {
   return m_pimpl->program;
 }
 
+Geometry::DrawKey Line::do_draw_key() const noexcept {
+  return {m_pimpl->program.id(), m_pimpl->vertex_array.key(), is_fading()};
+}
+
+std::optional<Bounds> Line::do_bounds() const {
+  // Pending points replace the current ones at the next render,
+  // double-precision points are culled relative to the eye (see do_render),
+  // and filled points are never read.
+  auto&& imp = *m_pimpl;
+  if (imp.pending || imp.is_precise || !imp.bounds_are_known) {
+    return std::nullopt;
+  }
+  return imp.bounds;
+}
+
+bool Line::is_fading() const noexcept {
+  return m_pimpl->fade && !m_pimpl->epochs.empty() &&
+         m_pimpl->trail_length > Duration();
+}
+
 /// @TODO Mark unused variables! Compilation must be 100% clean with no
 /// warnings.
-void Line::do_render(TimePoint t [[maybe_unused]]) {
+void Line::do_render(TimePoint t) {
+  m_pimpl->adopt_pending();
+
+  /// @TODO Add error checking!
+  auto first = m_pimpl->first_point;
+  auto count = m_pimpl->number_of_points;
+  if (m_pimpl->levels.size() > 1) {
+    const auto& level = m_pimpl->select_level();
+    first = level.first;
+    count = level.count;
+  }
+
+  const auto now = t.elapsed().seconds();
+  const auto trail = m_pimpl->trail_length.seconds();
+  if (!m_pimpl->epochs.empty()) {
+    // Epochs are sorted within each level, so the trail is a sub-range.
+    const auto begin = m_pimpl->epochs.begin() + first;
+    const auto end = begin + count;
+    const auto lower =
+        (trail > 0.0) ? std::lower_bound(begin, end, now - trail) : begin;
+    const auto upper = std::upper_bound(lower, end, now);
+    first = lower - m_pimpl->epochs.begin();
+    count = upper - lower;
+  }
+
+  // Chunks outside the frustum are skipped before touching any state.
+  m_pimpl->find_visible(first, count);
+  const auto& firsts = m_pimpl->draw_firsts;
+  const auto& counts = m_pimpl->draw_counts;
+  m_pimpl->rendered_points = 0;
+  for (auto&& n : counts) {
+    m_pimpl->rendered_points += n;
+  }
+  if (counts.empty()) {
+    return;
+  }
+
+  if (m_pimpl->program.revision() != m_pimpl->program_revision) {
+    m_pimpl->find_uniforms();
+  }
+
   auto&& program = m_pimpl->program;
   program.use();
-  program.set("color", m_pimpl->color);
+  program.set(m_pimpl->color_uniform, m_pimpl->color);
 
-  /// @TODO Add error checking!
-  glBindVertexArray(m_pimpl->vao_id);
-  glEnableVertexAttribArray(0);
-  glDrawArrays(GL_LINE_STRIP, 0, m_pimpl->number_of_points);
-  glDisableVertexAttribArray(0);
-  glBindVertexArray(0);
+  if (!m_pimpl->epochs.empty()) {
+    program.set(m_pimpl->time_uniform,
+                static_cast<float>(now - m_pimpl->reference_epoch));
+    program.set(m_pimpl->trail_length_uniform,
+                is_fading() ? static_cast<float>(trail) : 0.0f);
+  }
+
+  if (m_pimpl->is_extended) {
+    // The program is shared, so a line without epochs must clear the trail
+    // another line may have left set.
+    if (m_pimpl->epochs.empty()) {
+      program.set(m_pimpl->trail_length_uniform, 0.0f);
+    }
+
+    // Only the eye is split per frame; the points were split once on load.
+    // Other lines are drawn with the view and projection of the frame.
+    program.set(m_pimpl->relative_to_eye_uniform, m_pimpl->is_precise);
+
+    const bool quantized = (m_pimpl->loaded_encoding != Encoding::Float);
+    program.set(m_pimpl->quantized_uniform, quantized);
+    if (quantized) {
+      glActiveTexture(GL_TEXTURE0);
+      glBindTexture(GL_TEXTURE_BUFFER, m_pimpl->box_texture_id);
+      program.set(m_pimpl->chunk_boxes_uniform, 0);
+    }
+    // Every line subtracts the eye, so single-precision lines must clear the
+    // eye a double-precision line may have left set.
+    glm::vec3 eye_high{0.0f};
+    glm::vec3 eye_low{0.0f};
+    if (m_pimpl->is_precise) {
+      split(m_pimpl->eye, eye_high, eye_low);
+      program.set(m_pimpl->transform_uniform, m_pimpl->transform);
+    }
+    program.set(m_pimpl->eye_high_uniform, eye_high);
+    program.set(m_pimpl->eye_low_uniform, eye_low);
+  }
+
+  if (m_pimpl->is_wide) {
+    FrameUniforms::refresh_viewport();
+    program.set(m_pimpl->width_uniform, m_pimpl->width);
+  }
+
+  const bool blend = is_fading();
+  if (blend) {
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  }
+
+  m_pimpl->vertex_array.bind();
+  if (counts.size() == 1) {
+    glDrawArrays(GL_LINE_STRIP, firsts.front(), counts.front());
+  } else {
+    glMultiDrawArrays(GL_LINE_STRIP, firsts.data(), counts.data(),
+                      static_cast<GLsizei>(counts.size()));
+  }
+
+  if (blend) {
+    glDisable(GL_BLEND);
+  }
+
+  if (m_pimpl->streaming) {
+    // Protect the region just drawn until the GPU is done reading it.
+    auto& fence = m_pimpl->ring_fences[m_pimpl->ring_index];
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
 }
 
 }  // namespace nzl
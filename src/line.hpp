@@ -9,13 +9,18 @@
 #pragma once
 
 // C++ Standard Library
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <vector>
 
 // mxd Library
+#include "duration.hpp"
 #include "geometry.hpp"
+#include "point_view.hpp"
 #include "program.hpp"
 #include "time_point.hpp"
+#include "uploader.hpp"
 
 /// @TODO What benefit did you gain from acquiring a
 /// full dependency? Did you use any of the features of glm to make it
@@ -26,6 +31,24 @@ namespace nzl {
 
 class Line : public Geometry {
  public:
+  /// @brief Storage of the positions of a line on the GPU.
+  ///
+  /// Compact encodings are relative to chunks of 256 consecutive vertices:
+  /// the origin and scale of every chunk live in a small texture buffer, and
+  /// the vertex shader restores each position from them.
+  enum class Encoding {
+    Float,  ///< Three floats per vertex (12 bytes); positions are exact.
+    Half,   ///< Three half floats per vertex (6 bytes): offsets from the
+            ///< center of the chunk over its half-extent; error at most
+            ///< 1/8192 of the chunk extent.
+    Int16,  ///< Three 16-bit fractions of the box of the chunk (6 bytes);
+            ///< error below 1/131070 of the chunk extent.
+  };
+
+  /// @brief Writes points into a region of the vertex buffer (see
+  /// fill_points).
+  using Fill = std::function<void(glm::vec3* points)>;
+
   /// @brief Creates line with white color.
   Line();
 
@@ -40,14 +63,251 @@ class Line : public Geometry {
 
   /// @brief Loads points into the line's VBO.
   /// @param points Points to be loaded into the VBO.
+  /// @throws std::runtime_error if the line is streaming and its buffer
+  /// cannot be mapped.
+  /// @throws std::bad_alloc if the points cannot be staged.
   /// @note Affects all copies of this object.
-  void load_points(std::vector<glm::vec3>& points) noexcept;
+  void load_points(std::vector<glm::vec3>& points);
 
   /// @brief Loads points into the line's VBO.
   /// @param points Points to be loaded into the VBO.
   /// @param size Size of the array.
+  /// @throws std::runtime_error if the line is streaming and its buffer
+  /// cannot be mapped.
+  /// @throws std::bad_alloc if the points cannot be staged.
+  /// @note Affects all copies of this object.
+  void load_points(glm::vec3 points[], int size);
+
+  /// @brief Loads points from a view of memory in any layout.
+  /// @param points Points to be loaded into the VBO; doubles are converted to
+  /// single precision (see the glm::dvec3 overloads to keep them).
+  ///
+  /// Packed glm::vec3 are loaded as they are. Other layouts are converted
+  /// once, straight into the ring of a streaming line, or else into the
+  /// single copy that decimation reads.
+  /// @note Affects all copies of this object.
+  void load_points(const PointView& points);
+
+  /// @brief Lets the caller write points directly into the vertex buffer.
+  /// @param size Number of points.
+  /// @param fill Called once with a writable region of @p size points, which
+  /// it must fill; the region is only valid during the call.
+  /// @throws std::runtime_error if the buffer cannot be mapped, or whatever
+  /// @p fill throws (the line is then left empty, or keeps its previous
+  /// points if streaming).
+  ///
+  /// No copy of the points is made on the CPU: a streaming line hands out its
+  /// next ring region, which stays persistently mapped where supported, and
+  /// any other line reallocates and maps its buffer. As the points are never
+  /// read back, they are drawn at full resolution, without epochs, and never
+  /// culled, and are stored as floats whatever the encoding().
+  /// @note The region is write-only; reading it may be very slow.
+  /// @note Affects all copies of this object.
+  void fill_points(int size, const Fill& fill);
+
+  /// @brief Loads points, each with the epoch at which it is reached.
+  /// @param points Points to be loaded into the VBO.
+  /// @param epochs Epoch of every point, in ascending order.
+  /// @throws std::runtime_error if the sizes differ, the epochs are not
+  /// sorted, or the line is streaming.
+  ///
+  /// A line with epochs draws, at render time t, only the points with epochs
+  /// in [t - trail_length(), t]. The range is found by binary search, so
+  /// animating a trail along a long ephemeris uploads nothing per frame.
+  /// @note Affects all copies of this object.
+  void load_points(std::vector<glm::vec3>& points,
+                   const std::vector<TimePoint>& epochs);
+
+  /// @brief Loads double-precision points.
+  /// @param points Points to be loaded into the VBO.
+  /// @throws std::runtime_error if the line is streaming.
+  ///
+  /// Every point is split on load into the float nearest to it and the float
+  /// nearest to the remainder. The vertex shader subtracts the equally split
+  /// eye() from both parts before adding them, so the large magnitudes cancel
+  /// exactly and positions near the eye keep about 48 bits of precision: a
+  /// heliocentric trajectory in kilometres stays steady at metre scale, and
+  /// moving the eye uploads nothing but two uniforms.
+  /// @note Points are drawn at transform() * (point - eye()).
+  /// @note Affects all copies of this object.
+  void load_points(const std::vector<glm::dvec3>& points);
+
+  /// @brief Loads double-precision points, each with the epoch at which it is
+  /// reached.
+  /// @param points Points to be loaded into the VBO.
+  /// @param epochs Epoch of every point, in ascending order.
+  /// @throws std::runtime_error if the sizes differ, the epochs are not
+  /// sorted, or the line is streaming.
+  /// @note Affects all copies of this object.
+  void load_points(const std::vector<glm::dvec3>& points,
+                   const std::vector<TimePoint>& epochs);
+
+  /// @brief Loads points on the worker thread of an Uploader.
+  /// @param uploader Uploader sharing this line's context.
+  /// @param points Points to be loaded into the VBO.
+  /// @param epochs Epoch of every point, in ascending order, or none.
+  /// @return Ticket of the upload.
+  /// @throws std::runtime_error if the epochs do not match the points, or the
+  /// line is streaming.
+  ///
+  /// Decimation and upload run on the worker, into buffers of their own. The
+  /// line keeps drawing its current points until the first render after the
+  /// ticket is ready, which swaps the buffers in; loading a large ephemeris
+  /// therefore never stalls the render thread. A later load of any kind
+  /// supersedes a pending one.
+  /// @note Affects all copies of this object.
+  Uploader::Ticket load_points(Uploader& uploader,
+                               std::vector<glm::vec3> points,
+                               std::vector<TimePoint> epochs = {});
+
+  /// @brief Loads double-precision points on the worker thread of an
+  /// Uploader (see above).
+  /// @note Affects all copies of this object.
+  Uploader::Ticket load_points(Uploader& uploader,
+                               std::vector<glm::dvec3> points,
+                               std::vector<TimePoint> epochs = {});
+
+  /// @brief Returns whether points loaded through an Uploader are waiting to
+  /// be swapped in.
+  bool is_loading() const noexcept;
+
+  /// @brief Sets the encoding of the positions loaded from now on.
+  /// @param encoding Encoding of the positions (Encoding::Float by default).
+  /// @note Double-precision points, which need every bit, streaming lines,
+  /// which are rewritten every frame, and filled points (see fill_points),
+  /// which are written as glm::vec3 and never read back, are always loaded as
+  /// floats.
+  /// @note Affects all copies of this object.
+  void set_encoding(Encoding encoding) noexcept;
+
+  /// @brief Returns the encoding of the positions loaded from now on.
+  Encoding encoding() const noexcept;
+
+  /// @brief Returns the number of bytes the loaded positions occupy on the
+  /// GPU, every level of detail included.
+  std::size_t vertex_buffer_size() const noexcept;
+
+  /// @brief Returns whether the loaded points are in double precision.
+  bool is_double_precision() const noexcept;
+
+  /// @brief Sets the position the line is drawn relative to.
+  /// @param eye Eye (camera) position, in the units of the points.
+  /// @note Only affects lines with double-precision points.
+  /// @note Affects all copies of this object.
+  void set_eye(const glm::dvec3& eye) noexcept;
+
+  /// @brief Returns the position the line is drawn relative to.
+  glm::dvec3 eye() const noexcept;
+
+  /// @brief Sets the transformation from eye-relative coordinates to clip
+  /// space.
+  /// @param transform Transformation (identity by default), typically the
+  /// projection times the rotation of the view.
+  /// @note Only affects lines with double-precision points, whose pixel
+  /// scale should also be set (see set_pixel_scale). They are drawn with this
+  /// transformation instead of the view and projection of the frame (see
+  /// FrameUniforms), which cannot hold their precision.
+  /// @note Affects all copies of this object.
+  void set_transform(const glm::mat4& transform) noexcept;
+
+  /// @brief Returns the transformation from eye-relative coordinates to clip
+  /// space.
+  glm::mat4 transform() const noexcept;
+
+  /// @brief Returns whether the loaded points have epochs.
+  bool has_epochs() const noexcept;
+
+  /// @brief Sets the length of the trail drawn behind the render time.
+  /// @param trail_length Length of the trail; zero (the default) draws every
+  /// point up to the render time.
+  /// @note Only affects lines with epochs.
+  /// @note Affects all copies of this object.
+  void set_trail_length(Duration trail_length) noexcept;
+
+  /// @brief Returns the length of the trail.
+  Duration trail_length() const noexcept;
+
+  /// @brief Sets whether the trail fades out with age.
+  /// @param fade If true, the opacity of each point decreases linearly from
+  /// one at the render time to zero at the end of the trail.
+  /// @note Fading lines are blended, and need a positive trail length.
+  /// @note Affects all copies of this object.
+  void set_fade(bool fade) noexcept;
+
+  /// @brief Returns whether the trail fades out with age.
+  bool fade() const noexcept;
+
+  /// @brief Switches the line to streaming mode.
+  /// @param capacity Number of points expected per load.
+  ///
+  /// In streaming mode the points live in a ring of three regions of a single
+  /// buffer. Where supported, the buffer is created with glBufferStorage and
+  /// stays persistently mapped, so every load is a copy into mapped memory: the
+  /// driver never reallocates storage and a fence keeps each region from being
+  /// overwritten while the GPU may still be drawing it. Use this mode for lines
+  /// whose points change every frame.
+  ///
+  /// @note Loads larger than @p capacity grow the ring.
+  /// @note Points (and epochs) loaded before enabling streaming are
+  /// discarded.
   /// @note Affects all copies of this object.
-  void load_points(glm::vec3 points[], int size) noexcept;
+  void enable_streaming(int capacity);
+
+  /// @brief Returns whether the line is in streaming mode.
+  bool is_streaming() const noexcept;
+
+  /// @brief Sets the number of pixels spanned by one unit of the line's
+  /// coordinates.
+  /// @param pixels_per_unit Pixel scale; zero (the default) derives it every
+  /// frame from the viewport and the projection of the line's bounds by the
+  /// camera of the frame (see FrameUniforms), at the point nearest the eye.
+  ///
+  /// Lines of 4096 points or more are loaded together with a pyramid of
+  /// Douglas-Peucker decimations, each at least halving the previous one.
+  /// Every frame, the coarsest level whose error stays within
+  /// lod_tolerance() pixels is drawn, so the cost of drawing a long line
+  /// scales with its size on screen rather than with its number of points.
+  /// @note Affects all copies of this object.
+  void set_pixel_scale(float pixels_per_unit) noexcept;
+
+  /// @brief Returns the pixel scale (zero if derived from the viewport).
+  float pixel_scale() const noexcept;
+
+  /// @brief Sets the largest error, in pixels, of the drawn level of detail.
+  /// @param pixels Tolerance in pixels (half a pixel by default).
+  /// @note Affects all copies of this object.
+  void set_lod_tolerance(float pixels) noexcept;
+
+  /// @brief Returns the largest error, in pixels, of the drawn level of
+  /// detail.
+  float lod_tolerance() const noexcept;
+
+  /// @brief Returns the number of levels of detail, including the full
+  /// resolution line.
+  int number_of_levels() const noexcept;
+
+  /// @brief Returns the number of points submitted by the last draw.
+  ///
+  /// Lines are culled in chunks of 256 segments: only the runs of chunks
+  /// within the frustum of the frame (or of transform(), for lines with
+  /// double-precision points) are drawn, with a single glMultiDrawArrays.
+  /// @note Lines culled as a whole (see Geometry::render) keep the count of
+  /// their last draw.
+  int rendered_points() const noexcept;
+
+  /// @brief Sets the width of the line.
+  /// @param pixels Width in pixels (one by default).
+  ///
+  /// Core profiles ignore glLineWidth, so lines wider than one pixel are
+  /// expanded on the GPU: a geometry shader turns every segment of the
+  /// existing vertex buffer into a capsule of constant width on screen, and
+  /// the round ends of consecutive capsules form the joins. Thick lines cost
+  /// no extra CPU work or memory.
+  /// @note Affects all copies of this object.
+  void set_width(float pixels);
+
+  /// @brief Returns the width of the line, in pixels.
+  float width() const noexcept;
 
   /// @brief Returns the line's color.
   glm::vec3 color() const noexcept;
@@ -64,7 +324,11 @@ class Line : public Geometry {
   struct LineImp;
   std::shared_ptr<LineImp> m_pimpl;
 
+  bool is_fading() const noexcept;
+
   void do_render(TimePoint t) override;
+  DrawKey do_draw_key() const noexcept override;
+  std::optional<Bounds> do_bounds() const override;
 };
 
 }  // namespace nzl
@@ -10,10 +10,20 @@
 #include "line.hpp"
 
 // C++ Standard Library
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
 #include <vector>
 
 // mxd Library
+#include "camera.hpp"
+#include "duration.hpp"
+#include "frame_uniforms.hpp"
 #include "mxd.hpp"
+#include "offscreen_target.hpp"
+#include "point_view.hpp"
+#include "render_state.hpp"
 #include "time_point.hpp"
 #include "window.hpp"
 
@@ -25,6 +35,24 @@
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 
+namespace {  // anonymous namespace
+
+/// @brief Return the value of the half-precision float @p bits.
+float from_half(std::uint16_t bits) {
+  const float sign = (bits & 0x8000u) ? -1.0f : 1.0f;
+  const int exponent = (bits >> 10) & 0x1f;
+  const int mantissa = bits & 0x3ff;
+  if (exponent == 0x1f) {
+    return sign * INFINITY;
+  }
+  if (exponent == 0) {
+    return sign * std::ldexp(static_cast<float>(mantissa), -24);
+  }
+  return sign * std::ldexp(static_cast<float>(1024 + mantissa), exponent - 25);
+}
+
+}  // anonymous namespace
+
 TEST(Line, ConstructorAndParameterAccess) {
   nzl::initialize();
   nzl::Window win(800, 600, "Test Window");
@@ -44,6 +72,19 @@ TEST(Line, ConstructorAndParameterAccess) {
   nzl::terminate();
 }
 
+TEST(Line, ProgramIsShared) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Line line1;
+  nzl::Line line2(glm::vec3(1.0f, 0.0f, 0.0f));
+  EXPECT_EQ(line1.get_program().id(), line2.get_program().id());
+
+  nzl::terminate();
+}
+
 TEST(Line, OtherConstructors) {
   nzl::initialize();
   nzl::Window win(800, 600, "Test Window");
@@ -105,6 +146,588 @@ TEST(Line, DrawAndReplacePoints) {
   nzl::terminate();
 }
 
+TEST(Line, Streaming) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Line line(glm::vec3(1.0f, 1.0f, 0.0f));
+  EXPECT_FALSE(line.is_streaming());
+  line.enable_streaming(16);
+  EXPECT_TRUE(line.is_streaming());
+
+  // Cycle through the ring several times, including loads that force it to
+  // grow past its initial capacity.
+  for (int i = 0; i < 10; i++) {
+    std::vector<glm::vec3> points;
+    for (int k = 0; k < 4 * (i + 1); ++k) {
+      points.emplace_back(-1.0f + 0.05f * k, 0.1f * i - 0.5f, 0.0f);
+    }
+    line.load_points(points);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    line.render(nzl::TimePoint());
+
+    win.swap_buffers();
+  }
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, LevelOfDetail) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  // A slowly widening spiral of 200 revolutions.
+  const int size = 200000;
+  std::vector<glm::vec3> points;
+  for (int k = 0; k < size; ++k) {
+    const float angle = 2.0f * 3.14159265f * k / 1000.0f;
+    const float radius = 0.5f + 0.3f * k / size;
+    points.emplace_back(radius * std::cos(angle), radius * std::sin(angle),
+                        0.0f);
+  }
+
+  nzl::Line line(glm::vec3(1.0f, 1.0f, 0.0f), points);
+  EXPECT_GT(line.number_of_levels(), 1);
+  EXPECT_FLOAT_EQ(line.pixel_scale(), 0.0f);
+  EXPECT_FLOAT_EQ(line.lod_tolerance(), 0.5f);
+
+  // A small spiral on screen draws a coarse level.
+  line.set_pixel_scale(100.0f);
+  line.render(nzl::TimePoint());
+  EXPECT_GE(line.rendered_points(), 2);
+  EXPECT_LT(line.rendered_points(), size / 10);
+  const auto coarse = line.rendered_points();
+
+  // Zooming in draws finer levels, down to every point.
+  line.set_pixel_scale(10000.0f);
+  line.render(nzl::TimePoint());
+  EXPECT_GT(line.rendered_points(), coarse);
+
+  line.set_pixel_scale(1.0e9f);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), size);
+
+  // Short lines have a single level.
+  std::vector<glm::vec3> few(points.begin(), points.begin() + 100);
+  line.load_points(few);
+  EXPECT_EQ(line.number_of_levels(), 1);
+  line.set_pixel_scale(0.0f);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), 100);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, LevelOfDetailFollowsTheCamera) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+  glViewport(0, 0, 800, 600);
+  nzl::FrameUniforms::update_viewport();
+
+  const int size = 200000;
+  std::vector<glm::vec3> points;
+  for (int k = 0; k < size; ++k) {
+    const float angle = 2.0f * 3.14159265f * k / 1000.0f;
+    const float radius = 0.5f + 0.3f * k / size;
+    points.emplace_back(radius * std::cos(angle), radius * std::sin(angle),
+                        0.0f);
+  }
+  nzl::Line derived(glm::vec3(1.0f), points);
+  nzl::Line fixed(glm::vec3(1.0f), points);
+
+  // Without a camera, the viewport spans normalized device coordinates.
+  derived.render(nzl::TimePoint());
+  fixed.set_pixel_scale(400.0f);
+  fixed.render(nzl::TimePoint());
+  EXPECT_EQ(derived.rendered_points(), fixed.rendered_points());
+
+  // Zooming in draws the level of the scale of the camera: a view 0.002
+  // units tall spans 600 pixels.
+  nzl::Camera camera;
+  camera.look_at(glm::dvec3(0.65, 0.0, 1.0), glm::dvec3(0.65, 0.0, 0.0),
+                 glm::dvec3(0.0, 1.0, 0.0));
+  camera.set_orthographic(0.001, -2.0, 2.0);
+  camera.apply(nzl::TimePoint());
+  derived.render(nzl::TimePoint());
+  fixed.set_pixel_scale(300000.0f);
+  fixed.render(nzl::TimePoint());
+  EXPECT_GT(derived.rendered_points(), 0);
+  EXPECT_EQ(derived.rendered_points(), fixed.rendered_points());
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(Line, Trail) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  std::vector<glm::vec3> points;
+  std::vector<nzl::TimePoint> epochs;
+  for (int k = 0; k < 1000; ++k) {
+    points.emplace_back(-1.0f + 0.002f * k, 0.5f * std::sin(0.01f * k), 0.0f);
+    epochs.emplace_back(nzl::Duration::Seconds(k));
+  }
+
+  nzl::Line line(glm::vec3(1.0f, 1.0f, 0.0f));
+  EXPECT_FALSE(line.has_epochs());
+  line.load_points(points, epochs);
+  EXPECT_TRUE(line.has_epochs());
+
+  // Without a trail length, every point up to the render time is drawn.
+  line.render(nzl::TimePoint(nzl::Duration::Seconds(500)));
+  EXPECT_EQ(line.rendered_points(), 501);
+
+  line.set_trail_length(nzl::Duration::Seconds(100));
+  line.render(nzl::TimePoint(nzl::Duration::Seconds(500)));
+  EXPECT_EQ(line.rendered_points(), 101);
+
+  line.render(nzl::TimePoint(nzl::Duration::Seconds(-10)));
+  EXPECT_EQ(line.rendered_points(), 0);
+
+  // Fading trails are blended.
+  EXPECT_FALSE(line.draw_key().blending);
+  line.set_fade(true);
+  EXPECT_TRUE(line.fade());
+  EXPECT_TRUE(line.draw_key().blending);
+  for (int i = 0; i < 3; i++) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    line.render(nzl::TimePoint(nzl::Duration::Seconds(300 * i)));
+    win.swap_buffers();
+  }
+
+  // Loading points without epochs turns the trail off.
+  line.load_points(points);
+  EXPECT_FALSE(line.has_epochs());
+  EXPECT_FALSE(line.draw_key().blending);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), 1000);
+
+  epochs.pop_back();
+  EXPECT_THROW(line.load_points(points, epochs), std::runtime_error);
+  epochs.emplace_back(nzl::Duration::Seconds(0));
+  EXPECT_THROW(line.load_points(points, epochs), std::runtime_error);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, DoublePrecision) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  // A one-metre circle one astronomical unit (in km) from the origin, far
+  // below the resolution of single precision at that distance.
+  const glm::dvec3 center(1.495978707e8, 0.0, 0.0);
+  std::vector<glm::dvec3> points;
+  std::vector<nzl::TimePoint> epochs;
+  for (int k = 0; k <= 100; ++k) {
+    const double angle = 2.0 * 3.14159265358979 * k / 100.0;
+    points.push_back(center +
+                     glm::dvec3(1.0e-3 * std::cos(angle),
+                                1.0e-3 * std::sin(angle), 0.0));
+    epochs.emplace_back(nzl::Duration::Seconds(k));
+  }
+
+  nzl::Line line(glm::vec3(1.0f, 1.0f, 0.0f));
+  EXPECT_FALSE(line.is_double_precision());
+  line.load_points(points);
+  EXPECT_TRUE(line.is_double_precision());
+  EXPECT_FALSE(line.has_epochs());
+
+  line.set_eye(center);
+  EXPECT_DOUBLE_EQ(line.eye().x, center.x);
+  line.set_transform(glm::mat4(500.0f));
+  EXPECT_FLOAT_EQ(line.transform()[0][0], 500.0f);
+  for (int i = 0; i < 3; i++) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    line.render(nzl::TimePoint());
+    win.swap_buffers();
+  }
+  EXPECT_EQ(line.rendered_points(), 101);
+
+  // Double precision combines with epochs.
+  line.load_points(points, epochs);
+  EXPECT_TRUE(line.is_double_precision());
+  EXPECT_TRUE(line.has_epochs());
+  line.set_trail_length(nzl::Duration::Seconds(10));
+  line.render(nzl::TimePoint(nzl::Duration::Seconds(50)));
+  EXPECT_EQ(line.rendered_points(), 11);
+
+  // Single precision points turn it off again.
+  std::vector<glm::vec3> single{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}};
+  line.load_points(single);
+  EXPECT_FALSE(line.is_double_precision());
+
+  line.enable_streaming(16);
+  EXPECT_THROW(line.load_points(points), std::runtime_error);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, SinglePrecisionAfterDoublePrecision) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  const int size = 64;
+  nzl::OffscreenTarget target(size, size);
+  std::vector<unsigned char> pixels;
+  target.set_sink([&](const nzl::OffscreenTarget::Frame& frame) {
+    pixels.assign(frame.pixels, frame.pixels + frame.size);
+  });
+
+  // A double-precision line far from the origin, seen from its own eye.
+  const glm::dvec3 center(1.495978707e8, 0.0, 0.0);
+  std::vector<glm::dvec3> precise{center - glm::dvec3(0.5, 0.0, 0.0),
+                                  center + glm::dvec3(0.5, 0.0, 0.0)};
+  nzl::Line far_line(glm::vec3(1.0f, 0.0f, 0.0f));
+  far_line.load_points(precise);
+  far_line.set_eye(center);
+
+  // A timed single-precision line through the centers of row 32, which
+  // shares the program of the first.
+  const float y = 0.5f / size * 2.0f;
+  std::vector<glm::vec3> points{{-1.0f, y, 0.0f}, {1.0f, y, 0.0f}};
+  std::vector<nzl::TimePoint> epochs{nzl::TimePoint(),
+                                     nzl::TimePoint(nzl::Duration::Seconds(1))};
+  nzl::Line line(glm::vec3(0.0f, 1.0f, 0.0f));
+  line.load_points(points, epochs);
+  EXPECT_EQ(line.get_program().id(), far_line.get_program().id());
+
+  nzl::FrameUniforms::update(glm::mat4(1.0f), glm::mat4(1.0f),
+                             nzl::TimePoint());
+  target.bind();
+  glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+  glClear(GL_COLOR_BUFFER_BIT);
+  far_line.render(nzl::TimePoint());
+  glClear(GL_COLOR_BUFFER_BIT);
+  line.render(nzl::TimePoint(nzl::Duration::Seconds(1)));
+  target.unbind();
+  target.capture();
+  target.flush();
+
+  // The second line is drawn where its points are, not shifted by the eye
+  // of the first.
+  ASSERT_EQ(pixels.size(), static_cast<std::size_t>(size * size * 4));
+  const auto pixel = &pixels[(32 * size + 32) * 4];
+  EXPECT_EQ(pixel[0], 0);
+  EXPECT_EQ(pixel[1], 255);
+  EXPECT_EQ(pixel[2], 0);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, Width) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  std::vector<glm::vec3> points;
+  std::vector<nzl::TimePoint> epochs;
+  for (int k = 0; k < 100; ++k) {
+    points.emplace_back(-0.9f + 0.018f * k, 0.5f * std::sin(0.1f * k), 0.0f);
+    epochs.emplace_back(nzl::Duration::Seconds(k));
+  }
+
+  nzl::Line thin(glm::vec3(1.0f, 1.0f, 0.0f), points);
+  nzl::Line wide(glm::vec3(1.0f, 1.0f, 0.0f), points);
+  EXPECT_FLOAT_EQ(wide.width(), 1.0f);
+  wide.set_width(8.0f);
+  EXPECT_FLOAT_EQ(wide.width(), 8.0f);
+  EXPECT_NE(wide.get_program().id(), thin.get_program().id());
+
+  for (int i = 0; i < 3; i++) {
+    glClear(GL_COLOR_BUFFER_BIT);
+    thin.render(nzl::TimePoint());
+    wide.render(nzl::TimePoint());
+    win.swap_buffers();
+  }
+
+  // Wide lines keep fading trails.
+  wide.load_points(points, epochs);
+  wide.set_trail_length(nzl::Duration::Seconds(50));
+  wide.set_fade(true);
+  wide.render(nzl::TimePoint(nzl::Duration::Seconds(75)));
+  EXPECT_EQ(wide.rendered_points(), 51);
+
+  wide.set_width(1.0f);
+  wide.load_points(points);
+  EXPECT_EQ(wide.get_program().id(), thin.get_program().id());
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, WidthFollowsResizes) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  std::vector<glm::vec3> points{{-1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}};
+  nzl::Line line(glm::vec3(1.0f), points);
+  line.set_width(4.0f);
+
+  glViewport(0, 0, 800, 600);
+  nzl::FrameUniforms::update_viewport();
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(nzl::FrameUniforms::viewport(), glm::vec2(800.0f, 600.0f));
+
+  // A resize sets the viewport; wide lines pick it up without update().
+  glViewport(0, 0, 320, 200);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(nzl::FrameUniforms::viewport(), glm::vec2(320.0f, 200.0f));
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, LoadThroughUploader) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+  nzl::Uploader uploader(win);
+
+  std::vector<glm::vec3> points;
+  std::vector<nzl::TimePoint> epochs;
+  for (int k = 0; k < 10000; ++k) {
+    points.emplace_back(-1.0f + 0.0002f * k, 0.5f * std::sin(0.01f * k), 0.0f);
+    epochs.emplace_back(nzl::Duration::Seconds(k));
+  }
+
+  nzl::Line line(glm::vec3(1.0f, 1.0f, 0.0f));
+  auto ticket = line.load_points(uploader, points, epochs);
+  EXPECT_TRUE(line.is_loading());
+
+  // The line draws nothing until the upload completes and is swapped in.
+  line.render(nzl::TimePoint(nzl::Duration::Seconds(100)));
+  ticket.wait();
+  line.set_pixel_scale(1.0e9f);
+  line.render(nzl::TimePoint(nzl::Duration::Seconds(100)));
+  EXPECT_FALSE(line.is_loading());
+  EXPECT_TRUE(line.has_epochs());
+  EXPECT_GT(line.number_of_levels(), 1);
+  EXPECT_EQ(line.rendered_points(), 101);
+
+  // A synchronous load supersedes a pending one.
+  std::vector<glm::dvec3> precise(points.begin(), points.begin() + 10);
+  line.load_points(uploader, precise);
+  line.load_points(points);
+  EXPECT_FALSE(line.is_loading());
+  uploader.submit([] {}).wait();
+  line.render(nzl::TimePoint());
+  EXPECT_FALSE(line.is_double_precision());
+  EXPECT_EQ(line.rendered_points(), 10000);
+
+  epochs.pop_back();
+  EXPECT_THROW(line.load_points(uploader, points, epochs), std::runtime_error);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, Encodings) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  std::vector<glm::vec3> points;
+  std::vector<nzl::TimePoint> epochs;
+  for (int k = 0; k < 1000; ++k) {
+    points.emplace_back(0.9f * std::cos(0.01f * k), 0.9f * std::sin(0.01f * k),
+                        0.0f);
+    epochs.emplace_back(nzl::Duration::Seconds(k));
+  }
+
+  nzl::Line line;
+  EXPECT_EQ(line.encoding(), nzl::Line::Encoding::Float);
+  line.load_points(points);
+  EXPECT_EQ(line.vertex_buffer_size(), 1000 * 12u);
+
+  // Compact encodings halve the buffer and draw the same range.
+  for (auto encoding :
+       {nzl::Line::Encoding::Half, nzl::Line::Encoding::Int16}) {
+    line.set_encoding(encoding);
+    EXPECT_EQ(line.encoding(), encoding);
+    EXPECT_EQ(line.vertex_buffer_size(), 1000 * 12u);
+    line.load_points(points);
+    EXPECT_EQ(line.vertex_buffer_size(), 1000 * 6u);
+    line.render(nzl::TimePoint());
+    EXPECT_EQ(line.rendered_points(), 1000);
+
+    line.load_points(points, epochs);
+    line.set_width(3.0f);
+    line.render(nzl::TimePoint(nzl::Duration::Seconds(499)));
+    EXPECT_EQ(line.rendered_points(), 500);
+    line.set_width(1.0f);
+  }
+
+  // Double-precision points keep every bit.
+  std::vector<glm::dvec3> precise(points.begin(), points.end());
+  line.load_points(precise);
+  EXPECT_EQ(line.vertex_buffer_size(), 1000 * 12u);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
+TEST(Line, HalfEncodingOfLargeChunks) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  // A single chunk spanning far more than the largest half float, 65504.
+  std::vector<glm::vec3> points;
+  for (int k = 0; k < 256; ++k) {
+    points.emplace_back(800.0f * k, 5.0e4f * std::sin(0.05f * k), 7.0f);
+  }
+  glm::vec3 minimum = points.front();
+  glm::vec3 maximum = points.front();
+  for (auto&& p : points) {
+    minimum = glm::min(minimum, p);
+    maximum = glm::max(maximum, p);
+  }
+  ASSERT_GT(maximum.x - minimum.x, 1.0e5f);
+
+  nzl::Line line;
+  line.set_encoding(nzl::Line::Encoding::Half);
+  line.load_points(points);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), 256);
+
+  // Read the positions back through the vertex array the render left bound.
+  int buffer{0};
+  glGetVertexAttribiv(0, GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING, &buffer);
+  ASSERT_NE(buffer, 0);
+  std::vector<std::uint16_t> packed(3 * points.size());
+  nzl::RenderState::current().bind_buffer(GL_COPY_READ_BUFFER, buffer);
+  glGetBufferSubData(GL_COPY_READ_BUFFER, 0,
+                     packed.size() * sizeof(std::uint16_t), packed.data());
+
+  // Offsets from the center over the half-extent restore every point within
+  // 1/8192 of the extent; a flat axis restores exactly.
+  const auto center = 0.5f * (minimum + maximum);
+  const auto half_extent = 0.5f * (maximum - minimum);
+  for (std::size_t k = 0; k < points.size(); ++k) {
+    for (int i = 0; i < 3; ++i) {
+      const float value = from_half(packed[3 * k + i]);
+      ASSERT_TRUE(std::isfinite(value));
+      EXPECT_NEAR(center[i] + half_extent[i] * value, points[k][i],
+                  2.0f * half_extent[i] / 8192.0f + 1.0e-2f);
+    }
+  }
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(Line, LoadViewsAndFill) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  // Positions interleaved with velocities, as a propagator keeps them.
+  std::vector<double> states;
+  for (int k = 0; k < 100; ++k) {
+    states.insert(states.end(), {-0.9 + 0.018 * k, 0.5, 0.0, 1.0, 0.0, 0.0});
+  }
+  const nzl::PointView view(states.data(), 100, 6 * sizeof(double));
+
+  nzl::Line line;
+  line.load_points(view);
+  ASSERT_TRUE(line.bounds().has_value());
+  EXPECT_FLOAT_EQ(line.bounds()->minimum[0], -0.9);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), 100);
+
+  // Filled points are written straight into the buffer.
+  line.fill_points(50, [](glm::vec3* points) {
+    for (int k = 0; k < 50; ++k) {
+      points[k] = glm::vec3(-0.5f + 0.02f * k, -0.5f, 0.0f);
+    }
+  });
+  EXPECT_FALSE(line.bounds().has_value());
+  EXPECT_EQ(line.vertex_buffer_size(), 50 * 12u);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), 50);
+
+  // Filled points are always floats: the fill writes them as glm::vec3, and
+  // they are never read back to be encoded. The encoding still applies to
+  // the next load.
+  line.set_encoding(nzl::Line::Encoding::Half);
+  line.fill_points(50, [](glm::vec3* points) {
+    std::fill(points, points + 50, glm::vec3(0.25f));
+  });
+  EXPECT_EQ(line.encoding(), nzl::Line::Encoding::Half);
+  EXPECT_EQ(line.vertex_buffer_size(), 50 * 12u);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), 50);
+  line.load_points(view);
+  EXPECT_EQ(line.vertex_buffer_size(), 100 * 6u);
+  line.set_encoding(nzl::Line::Encoding::Float);
+
+  // A failed fill leaves the line empty.
+  const auto failing = [](glm::vec3*) { throw std::runtime_error("Failed"); };
+  EXPECT_THROW(line.fill_points(10, failing), std::runtime_error);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), 0);
+
+  // Streaming lines convert or fill straight into the ring, and keep their
+  // points if a fill fails.
+  line.enable_streaming(100);
+  for (int i = 0; i < 4; ++i) {
+    line.load_points(view);
+    line.render(nzl::TimePoint());
+    EXPECT_EQ(line.rendered_points(), 100);
+    line.fill_points(20, [](glm::vec3* points) {
+      std::fill(points, points + 20, glm::vec3(0.0f));
+    });
+    line.render(nzl::TimePoint());
+    EXPECT_EQ(line.rendered_points(), 20);
+  }
+  EXPECT_THROW(line.fill_points(10, failing), std::runtime_error);
+  line.render(nzl::TimePoint());
+  EXPECT_EQ(line.rendered_points(), 20);
+
+  EXPECT_EQ(glGetError(), 0);
+
+  nzl::terminate();
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
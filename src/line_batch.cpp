@@ -0,0 +1,563 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      line_batch.cpp
+/// @brief     Implementation of line_batch.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "line_batch.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// mxd Library
+#include "program.hpp"
+#include "program_cache.hpp"
+#include "render_state.hpp"
+#include "shader.hpp"
+#include "shader_library.hpp"
+#include "time_point.hpp"
+#include "vertex_array.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+/// @brief Minimum number of vertices allocated when the shared buffer grows.
+const std::size_t minimum_capacity = 1024;
+
+nzl::Program make_program() {
+  return nzl::ProgramCache::get(
+      {{nzl::Shader::Stage::Vertex,
+        nzl::ShaderLibrary::get("batch_shader.vert")},
+       {nzl::Shader::Stage::Fragment,
+        nzl::ShaderLibrary::get("batch_shader.frag")}});
+}
+
+/// @brief Minimum number of commands allocated when the command buffer grows.
+const std::size_t minimum_command_capacity = 64;
+
+/// @brief Return the number of bytes occupied by @p count vertices.
+GLsizeiptr vertex_bytes(std::size_t count) noexcept {
+  return static_cast<GLsizeiptr>(count * 3 * sizeof(float));
+}
+
+/// @brief Return the box of @p points.
+nzl::Bounds bounds_of(const std::vector<glm::vec3>& points) noexcept {
+  nzl::Bounds bounds;
+  for (auto&& point : points) {
+    bounds.extend(glm::dvec3(point));
+  }
+  return bounds;
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+struct LineBatch::LineBatchImp {
+  /// @brief Location of a polyline within the shared buffers.
+  struct Member {
+    std::size_t first{0};
+    std::size_t count{0};
+    std::size_t reserved{0};
+    std::size_t slot{0};
+    bool visible{true};
+    glm::vec3 color;
+    nzl::Bounds bounds;
+  };
+
+  /// @brief Parameters of one draw of glMultiDrawArraysIndirect, in the
+  /// layout OpenGL reads from the command buffer.
+  struct Command {
+    GLuint count{0};
+    GLuint instance_count{0};
+    GLuint first{0};
+    GLuint base_instance{0};
+  };
+
+  /// @brief First vertex and color of a visible member, in the layout the
+  /// vertex shader reads as one RGBA32UI texel (the color as float bits).
+  struct Range {
+    GLuint first{0};
+    glm::vec3 color;
+  };
+  static_assert(sizeof(Range) == 4 * sizeof(GLuint));
+
+  nzl::Program program;
+  unsigned int program_revision{0};
+  nzl::UniformHandle<bool> ranged_uniform;
+  nzl::UniformHandle<int> ranges_uniform;
+  nzl::VertexArray vertex_array;
+  unsigned int position_vbo_id{0};
+  std::size_t capacity{0};
+  LineBatch::Id next_id{0};
+  std::map<LineBatch::Id, Member> members;
+
+  /// Free sub-ranges of the shared buffers, keyed by first vertex.
+  std::map<std::size_t, std::size_t> free_blocks;
+
+  /// One command and one color per slot, mirrored in the command and color
+  /// buffers. Every member owns a slot until it is removed; free slots hold
+  /// empty commands. The base instance of a command is its slot, which
+  /// selects the color of the member.
+  bool is_indirect{false};
+  unsigned int command_vbo_id{0};
+  unsigned int color_vbo_id{0};
+  std::size_t command_capacity{0};
+  std::vector<Command> commands;
+  std::vector<glm::vec3> colors;
+  std::vector<std::size_t> free_slots;
+
+  /// Slots [dirty_begin, dirty_end) hold every command and color changed
+  /// since the buffers were last written; they are uploaded together by
+  /// flush_commands().
+  std::size_t dirty_begin{0};
+  std::size_t dirty_end{0};
+
+  /// Arguments to glMultiDrawArrays, used without indirect draws and rebuilt
+  /// only when membership, visibility or color changes. The ranges of the
+  /// drawn members, sorted by first vertex, are read through a buffer texture
+  /// so the vertex shader can look up the color of each vertex.
+  std::vector<GLint> firsts;
+  std::vector<GLsizei> counts;
+  std::vector<Range> ranges;
+  unsigned int range_vbo_id{0};
+  unsigned int range_texture_id{0};
+  bool draw_list_is_dirty{false};
+
+  /// Box of every member, recomputed only after a change.
+  nzl::Bounds bounds;
+  bool bounds_are_dirty{false};
+
+  LineBatchImp();
+  ~LineBatchImp() noexcept;
+
+  Member& find(LineBatch::Id id);
+  std::size_t allocate(std::size_t count);
+  void release(std::size_t first, std::size_t count);
+  void grow(std::size_t required_capacity);
+  void bind_attributes();
+  void write_points(const Member& member, const glm::vec3* points);
+  std::size_t acquire_slot();
+  void mark_dirty(std::size_t slot) noexcept;
+  void write_color(const Member& member);
+  void write_command(const Member& member);
+  void write_command(std::size_t slot, const Command& command);
+  void flush_commands();
+  void rebuild_draw_list();
+  void find_uniforms();
+};
+
+LineBatch::LineBatchImp::LineBatchImp()
+    : program{make_program()},
+      vertex_array{[this] { bind_attributes(); }},
+      is_indirect{GLEW_ARB_multi_draw_indirect && GLEW_ARB_base_instance} {
+  find_uniforms();
+  glGenBuffers(1, &position_vbo_id);
+  if (is_indirect) {
+    glGenBuffers(1, &command_vbo_id);
+    glGenBuffers(1, &color_vbo_id);
+  } else {
+    glGenBuffers(1, &range_vbo_id);
+    RenderState::current().bind_buffer(GL_TEXTURE_BUFFER, range_vbo_id);
+    glBufferData(GL_TEXTURE_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
+    glGenTextures(1, &range_texture_id);
+    glBindTexture(GL_TEXTURE_BUFFER, range_texture_id);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32UI, range_vbo_id);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+  }
+}
+
+LineBatch::LineBatchImp::~LineBatchImp() noexcept {
+  auto& state = RenderState::current();
+  state.forget_buffer(position_vbo_id);
+  state.forget_buffer(color_vbo_id);
+  state.forget_buffer(command_vbo_id);
+  state.forget_buffer(range_vbo_id);
+  glDeleteTextures(1, &range_texture_id);
+  glDeleteBuffers(1, &position_vbo_id);
+  glDeleteBuffers(1, &color_vbo_id);
+  glDeleteBuffers(1, &command_vbo_id);
+  glDeleteBuffers(1, &range_vbo_id);
+}
+
+LineBatch::LineBatchImp::Member& LineBatch::LineBatchImp::find(
+    LineBatch::Id id) {
+  if (auto it = members.find(id); it != members.end()) {
+    return it->second;
+  }
+  std::ostringstream oss;
+  oss << "LineBatch does not contain a polyline with id " << id;
+  throw std::runtime_error(oss.str());
+}
+
+std::size_t LineBatch::LineBatchImp::allocate(std::size_t count) {
+  if (count == 0) {
+    return 0;
+  }
+
+  // First fit: take the lowest free block large enough to hold the polyline.
+  for (auto it = free_blocks.begin(); it != free_blocks.end(); ++it) {
+    if (auto [first, size] = *it; size >= count) {
+      free_blocks.erase(it);
+      if (size > count) {
+        free_blocks.emplace(first + count, size - count);
+      }
+      return first;
+    }
+  }
+
+  grow(capacity + count);
+  return allocate(count);
+}
+
+void LineBatch::LineBatchImp::release(std::size_t first, std::size_t count) {
+  if (count == 0) {
+    return;
+  }
+
+  auto it = free_blocks.emplace(first, count).first;
+
+  // Coalesce with the following block.
+  if (auto next = std::next(it);
+      next != free_blocks.end() && it->first + it->second == next->first) {
+    it->second += next->second;
+    free_blocks.erase(next);
+  }
+
+  // Coalesce with the preceding block.
+  if (it != free_blocks.begin()) {
+    if (auto prev = std::prev(it); prev->first + prev->second == it->first) {
+      prev->second += it->second;
+      free_blocks.erase(it);
+    }
+  }
+}
+
+void LineBatch::LineBatchImp::grow(std::size_t required_capacity) {
+  const auto new_capacity =
+      std::max({required_capacity, 2 * capacity, minimum_capacity});
+
+  // Allocate a larger buffer and copy the current contents on the GPU, so the
+  // existing polylines need not be re-uploaded.
+  auto& state = RenderState::current();
+  unsigned int new_vbo_id{0};
+  glGenBuffers(1, &new_vbo_id);
+  state.bind_buffer(GL_COPY_WRITE_BUFFER, new_vbo_id);
+  glBufferData(GL_COPY_WRITE_BUFFER, vertex_bytes(new_capacity), nullptr,
+               GL_DYNAMIC_DRAW);
+  if (capacity > 0) {
+    state.bind_buffer(GL_COPY_READ_BUFFER, position_vbo_id);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0,
+                        vertex_bytes(capacity));
+  }
+  state.forget_buffer(position_vbo_id);
+  glDeleteBuffers(1, &position_vbo_id);
+  position_vbo_id = new_vbo_id;
+
+  const auto old_capacity = capacity;
+  capacity = new_capacity;
+  release(old_capacity, new_capacity - old_capacity);
+  vertex_array.update();
+}
+
+void LineBatch::LineBatchImp::bind_attributes() {
+  auto& state = RenderState::current();
+  state.bind_buffer(GL_ARRAY_BUFFER, position_vbo_id);
+  glEnableVertexAttribArray(0);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+
+  // One color per member: per instance with indirect draws, where the base
+  // instance of each command is the slot of its member. Otherwise the color
+  // is looked up from the ranges of the members (see rebuild_draw_list).
+  if (is_indirect) {
+    state.bind_buffer(GL_ARRAY_BUFFER, color_vbo_id);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float),
+                          (void*)0);
+    glVertexAttribDivisor(1, 1);
+  }
+}
+
+void LineBatch::LineBatchImp::write_points(const Member& member,
+                                           const glm::vec3* points) {
+  if (member.count == 0) {
+    return;
+  }
+  RenderState::current().bind_buffer(GL_ARRAY_BUFFER, position_vbo_id);
+  glBufferSubData(GL_ARRAY_BUFFER, vertex_bytes(member.first),
+                  vertex_bytes(member.count), points);
+}
+
+std::size_t LineBatch::LineBatchImp::acquire_slot() {
+  if (!free_slots.empty()) {
+    const auto slot = free_slots.back();
+    free_slots.pop_back();
+    return slot;
+  }
+  commands.emplace_back();
+  colors.emplace_back();
+  return commands.size() - 1;
+}
+
+void LineBatch::LineBatchImp::write_color(const Member& member) {
+  colors[member.slot] = member.color;
+  mark_dirty(member.slot);
+}
+
+void LineBatch::LineBatchImp::write_command(const Member& member) {
+  Command command;
+  command.count = static_cast<GLuint>(member.count);
+  command.instance_count = member.visible ? 1 : 0;
+  command.first = static_cast<GLuint>(member.first);
+  command.base_instance = static_cast<GLuint>(member.slot);
+  write_command(member.slot, command);
+}
+
+void LineBatch::LineBatchImp::write_command(std::size_t slot,
+                                            const Command& command) {
+  commands[slot] = command;
+  mark_dirty(slot);
+}
+
+void LineBatch::LineBatchImp::mark_dirty(std::size_t slot) noexcept {
+  draw_list_is_dirty = true;
+  if (dirty_begin == dirty_end) {
+    dirty_begin = slot;
+    dirty_end = slot + 1;
+  } else {
+    dirty_begin = std::min(dirty_begin, slot);
+    dirty_end = std::max(dirty_end, slot + 1);
+  }
+}
+
+void LineBatch::LineBatchImp::flush_commands() {
+  if (!is_indirect || dirty_begin == dirty_end) {
+    return;
+  }
+
+  auto& state = RenderState::current();
+  if (commands.size() > command_capacity) {
+    // Reallocate and upload every slot; growth is geometric, so this is rare.
+    // The buffers keep their names, so the vertex array remains valid.
+    command_capacity = std::max(
+        {commands.size(), 2 * command_capacity, minimum_command_capacity});
+    state.bind_buffer(GL_DRAW_INDIRECT_BUFFER, command_vbo_id);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, command_capacity * sizeof(Command),
+                 nullptr, GL_DYNAMIC_DRAW);
+    state.bind_buffer(GL_ARRAY_BUFFER, color_vbo_id);
+    glBufferData(GL_ARRAY_BUFFER, command_capacity * sizeof(glm::vec3),
+                 nullptr, GL_DYNAMIC_DRAW);
+    dirty_begin = 0;
+    dirty_end = commands.size();
+  }
+  const auto count = dirty_end - dirty_begin;
+  state.bind_buffer(GL_DRAW_INDIRECT_BUFFER, command_vbo_id);
+  glBufferSubData(GL_DRAW_INDIRECT_BUFFER, dirty_begin * sizeof(Command),
+                  count * sizeof(Command), commands.data() + dirty_begin);
+  state.bind_buffer(GL_ARRAY_BUFFER, color_vbo_id);
+  glBufferSubData(GL_ARRAY_BUFFER, dirty_begin * sizeof(glm::vec3),
+                  count * sizeof(glm::vec3), colors.data() + dirty_begin);
+  dirty_begin = 0;
+  dirty_end = 0;
+}
+
+void LineBatch::LineBatchImp::rebuild_draw_list() {
+  std::vector<const Member*> drawn;
+  for (auto&& [id, member] : members) {
+    // A line strip needs at least two vertices to produce a segment.
+    if (member.visible && member.count > 1) {
+      drawn.push_back(&member);
+    }
+  }
+  std::sort(drawn.begin(), drawn.end(), [](auto a, auto b) {
+    return a->first < b->first;
+  });
+
+  firsts.clear();
+  counts.clear();
+  ranges.clear();
+  for (auto* member : drawn) {
+    firsts.push_back(static_cast<GLint>(member->first));
+    counts.push_back(static_cast<GLsizei>(member->count));
+    ranges.push_back({static_cast<GLuint>(member->first), member->color});
+  }
+  RenderState::current().bind_buffer(GL_TEXTURE_BUFFER, range_vbo_id);
+  glBufferData(GL_TEXTURE_BUFFER, ranges.size() * sizeof(Range),
+               ranges.data(), GL_DYNAMIC_DRAW);
+  draw_list_is_dirty = false;
+}
+
+void LineBatch::LineBatchImp::find_uniforms() {
+  program_revision = program.revision();
+  ranged_uniform = program.uniform<bool>("is_ranged");
+  ranges_uniform = program.uniform<int>("ranges");
+}
+
+// -----------------------------------------------------------------------------
+//         The section below forwards API calls to the implementation
+// -----------------------------------------------------------------------------
+
+LineBatch::LineBatch() : m_pimpl{std::make_shared<LineBatch::LineBatchImp>()} {}
+
+LineBatch::Id LineBatch::add(glm::vec3 color,
+                             const std::vector<glm::vec3>& points) {
+  LineBatchImp::Member member;
+  member.count = points.size();
+  member.reserved = points.size();
+  member.first = m_pimpl->allocate(member.reserved);
+  member.slot = m_pimpl->acquire_slot();
+  member.color = color;
+  member.bounds = bounds_of(points);
+
+  m_pimpl->write_points(member, points.data());
+  m_pimpl->write_color(member);
+  m_pimpl->write_command(member);
+
+  const auto id = m_pimpl->next_id++;
+  m_pimpl->members.emplace(id, member);
+  m_pimpl->bounds_are_dirty = true;
+  return id;
+}
+
+void LineBatch::update(Id id, const std::vector<glm::vec3>& points) {
+  auto& member = m_pimpl->find(id);
+
+  if (points.size() > member.reserved) {
+    m_pimpl->release(member.first, member.reserved);
+    member.reserved = points.size();
+    member.first = m_pimpl->allocate(member.reserved);
+  }
+  member.count = points.size();
+
+  m_pimpl->write_points(member, points.data());
+  m_pimpl->write_command(member);
+  member.bounds = bounds_of(points);
+  m_pimpl->bounds_are_dirty = true;
+}
+
+void LineBatch::remove(Id id) {
+  auto& member = m_pimpl->find(id);
+  m_pimpl->release(member.first, member.reserved);
+  m_pimpl->write_command(member.slot, {});
+  m_pimpl->free_slots.push_back(member.slot);
+  m_pimpl->members.erase(id);
+  m_pimpl->bounds_are_dirty = true;
+}
+
+void LineBatch::set_visible(Id id, bool visible) {
+  auto& member = m_pimpl->find(id);
+  if (member.visible != visible) {
+    member.visible = visible;
+    m_pimpl->write_command(member);
+  }
+}
+
+bool LineBatch::is_visible(Id id) const { return m_pimpl->find(id).visible; }
+
+bool LineBatch::contains(Id id) const noexcept {
+  return m_pimpl->members.count(id) > 0;
+}
+
+glm::vec3 LineBatch::color(Id id) const { return m_pimpl->find(id).color; }
+
+void LineBatch::set_color(Id id, glm::vec3 color) {
+  auto& member = m_pimpl->find(id);
+  member.color = color;
+  m_pimpl->write_color(member);
+}
+
+std::size_t LineBatch::size() const noexcept { return m_pimpl->members.size(); }
+
+std::size_t LineBatch::capacity() const noexcept { return m_pimpl->capacity; }
+
+bool LineBatch::is_indirect() const noexcept { return m_pimpl->is_indirect; }
+
+unsigned int LineBatch::command_buffer() const noexcept {
+  m_pimpl->flush_commands();
+  return m_pimpl->command_vbo_id;
+}
+
+std::size_t LineBatch::number_of_commands() const noexcept {
+  return m_pimpl->commands.size();
+}
+
+const nzl::Program& LineBatch::get_program() const noexcept {
+  return m_pimpl->program;
+}
+
+Geometry::DrawKey LineBatch::do_draw_key() const noexcept {
+  return {m_pimpl->program.id(), m_pimpl->vertex_array.key(), false};
+}
+
+std::optional<Bounds> LineBatch::do_bounds() const {
+  if (m_pimpl->bounds_are_dirty) {
+    m_pimpl->bounds = Bounds();
+    for (auto&& [id, member] : m_pimpl->members) {
+      m_pimpl->bounds.extend(member.bounds);
+    }
+    m_pimpl->bounds_are_dirty = false;
+  }
+  return m_pimpl->bounds;
+}
+
+void LineBatch::do_render(TimePoint t [[maybe_unused]]) {
+  if (m_pimpl->is_indirect) {
+    // Every command is submitted, visible or not: the cost on the CPU does
+    // not depend on the number of members.
+    if (m_pimpl->commands.empty()) {
+      return;
+    }
+    m_pimpl->flush_commands();
+    if (m_pimpl->program.revision() != m_pimpl->program_revision) {
+      m_pimpl->find_uniforms();
+    }
+    // The program is shared with batches that may look colors up by range.
+    m_pimpl->program.use();
+    m_pimpl->program.set(m_pimpl->ranged_uniform, false);
+    m_pimpl->vertex_array.bind();
+    RenderState::current().bind_buffer(GL_DRAW_INDIRECT_BUFFER,
+                                       m_pimpl->command_vbo_id);
+    glMultiDrawArraysIndirect(GL_LINE_STRIP, nullptr,
+                              static_cast<GLsizei>(m_pimpl->commands.size()),
+                              0);
+    return;
+  }
+
+  if (m_pimpl->draw_list_is_dirty) {
+    m_pimpl->rebuild_draw_list();
+  }
+
+  if (m_pimpl->counts.empty()) {
+    return;
+  }
+
+  if (m_pimpl->program.revision() != m_pimpl->program_revision) {
+    m_pimpl->find_uniforms();
+  }
+  m_pimpl->program.use();
+  m_pimpl->program.set(m_pimpl->ranged_uniform, true);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_BUFFER, m_pimpl->range_texture_id);
+  m_pimpl->program.set(m_pimpl->ranges_uniform, 0);
+
+  m_pimpl->vertex_array.bind();
+  glMultiDrawArrays(GL_LINE_STRIP, m_pimpl->firsts.data(),
+                    m_pimpl->counts.data(),
+                    static_cast<GLsizei>(m_pimpl->counts.size()));
+}
+
+}  // namespace nzl
@@ -0,0 +1,139 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      line_batch.hpp
+/// @brief     Many polylines packed into a single buffer and drawn at once.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// mxd Library
+#include "geometry.hpp"
+#include "program.hpp"
+#include "time_point.hpp"
+
+// Third party forward declaration headers
+#include <glm/fwd.hpp>
+
+namespace nzl {
+
+/// @brief A collection of polylines rendered with a single draw call.
+///
+/// Every member polyline lives in a sub-range of one shared vertex buffer. The
+/// whole batch is drawn with a single draw call, regardless of the number of
+/// members. Members can be added, updated, recolored, hidden, and removed
+/// individually; only the affected sub-range of the buffer is touched. Colors
+/// are kept once per member, not per vertex.
+///
+/// Where ARB_multi_draw_indirect and ARB_base_instance are supported, the draw
+/// parameters and color of every member live on the GPU, in a command buffer
+/// read by glMultiDrawArraysIndirect (see command_buffer()) and a color buffer
+/// read once per draw. Rendering then submits the same single call every
+/// frame. Changes to members only mark their slots, and the next render
+/// writes every marked command and color with a single upload each.
+/// Elsewhere the batch falls back to a single glMultiDrawArrays, with a draw
+/// list rebuilt after each change; the vertex shader then finds the color of
+/// each vertex among the ranges of the drawn members.
+class LineBatch : public Geometry {
+ public:
+  /// @brief Identifier of a polyline within a LineBatch.
+  using Id = std::size_t;
+
+  /// @brief Creates an empty LineBatch.
+  LineBatch();
+
+  /// @brief Adds a polyline to the batch.
+  /// @param color Color of the polyline.
+  /// @param points Vertices of the polyline.
+  /// @return Identifier used to refer to the polyline afterwards.
+  /// @note Affects all copies of this object.
+  Id add(glm::vec3 color, const std::vector<glm::vec3>& points);
+
+  /// @brief Replaces the vertices of a polyline.
+  /// @param id Identifier returned by add().
+  /// @param points New vertices of the polyline.
+  /// @throws std::runtime_error if @p id is not in the batch.
+  /// @note The polyline is rewritten in place whenever it fits in the space it
+  /// already occupies; otherwise it is moved to a new sub-range.
+  void update(Id id, const std::vector<glm::vec3>& points);
+
+  /// @brief Removes a polyline from the batch.
+  /// @param id Identifier returned by add().
+  /// @throws std::runtime_error if @p id is not in the batch.
+  void remove(Id id);
+
+  /// @brief Returns whether the batch contains a polyline.
+  /// @param id Identifier returned by add().
+  bool contains(Id id) const noexcept;
+
+  /// @brief Returns the color of a polyline.
+  /// @param id Identifier returned by add().
+  /// @throws std::runtime_error if @p id is not in the batch.
+  glm::vec3 color(Id id) const;
+
+  /// @brief Sets the color of a polyline.
+  /// @param id Identifier returned by add().
+  /// @param color Color to be set.
+  /// @throws std::runtime_error if @p id is not in the batch.
+  void set_color(Id id, glm::vec3 color);
+
+  /// @brief Shows or hides a polyline.
+  /// @param id Identifier returned by add().
+  /// @param visible Whether the polyline is drawn.
+  /// @throws std::runtime_error if @p id is not in the batch.
+  /// @note With indirect draws, only the command of the polyline is
+  /// rewritten, at the next render.
+  void set_visible(Id id, bool visible);
+
+  /// @brief Returns whether a polyline is drawn.
+  /// @param id Identifier returned by add().
+  /// @throws std::runtime_error if @p id is not in the batch.
+  bool is_visible(Id id) const;
+
+  /// @brief Returns the number of polylines in the batch.
+  std::size_t size() const noexcept;
+
+  /// @brief Returns the number of vertices the shared buffer can hold before
+  /// it needs to grow.
+  std::size_t capacity() const noexcept;
+
+  /// @brief Returns whether the batch is drawn from its command buffer.
+  bool is_indirect() const noexcept;
+
+  /// @brief Returns the buffer of draw commands, or zero without indirect
+  /// draws.
+  ///
+  /// The buffer holds number_of_commands() DrawArraysIndirectCommand
+  /// structures (count, instance count, first, base instance; four unsigned
+  /// integers each). The instance count of a command is the visibility flag
+  /// of its member, one or zero, so a GPU pass may cull members by writing
+  /// it directly; set_visible() overwrites it. The base instance is the slot
+  /// of the member, which selects its color.
+  /// @note Commands changed since the last render are uploaded first, so the
+  /// buffer is current. Requires the context of the batch to be current.
+  /// @note The buffer is reallocated when the batch grows.
+  unsigned int command_buffer() const noexcept;
+
+  /// @brief Returns the number of commands submitted per draw, which includes
+  /// the empty commands of removed polylines until their slots are reused.
+  std::size_t number_of_commands() const noexcept;
+
+  /// @brief Returns the program used by the batch.
+  const nzl::Program& get_program() const noexcept;
+
+ private:
+  struct LineBatchImp;
+  std::shared_ptr<LineBatchImp> m_pimpl;
+
+  void do_render(TimePoint t) override;
+  DrawKey do_draw_key() const noexcept override;
+  std::optional<Bounds> do_bounds() const override;
+};
+
+}  // namespace nzl
@@ -0,0 +1,244 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      line_batch.t.cpp
+/// @brief     Unit tests for line_batch.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "line_batch.hpp"
+
+// C++ Standard Library
+#include <stdexcept>
+#include <vector>
+
+// mxd Library
+#include "mxd.hpp"
+#include "offscreen_target.hpp"
+#include "render_state.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+std::vector<glm::vec3> make_points(std::size_t size) {
+  std::vector<glm::vec3> points;
+  for (auto k = 0u; k < size; ++k) {
+    points.emplace_back(-1.0f + 2.0f * k / size, 0.5f, 0.0f);
+  }
+  return points;
+}
+
+}  // anonymous namespace
+
+TEST(LineBatch, ConstructorAndParameterAccess) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::LineBatch batch;
+  EXPECT_EQ(batch.size(), 0u);
+  EXPECT_EQ(batch.capacity(), 0u);
+  EXPECT_NE(batch.get_program().id(), 0u);
+
+  auto id = batch.add(glm::vec3(0.4f, 0.5f, 0.3f), make_points(10));
+  EXPECT_TRUE(batch.contains(id));
+  EXPECT_EQ(batch.size(), 1u);
+  EXPECT_GE(batch.capacity(), 10u);
+
+  EXPECT_FLOAT_EQ(batch.color(id).x, 0.4f);
+  EXPECT_FLOAT_EQ(batch.color(id).y, 0.5f);
+  EXPECT_FLOAT_EQ(batch.color(id).z, 0.3f);
+
+  batch.set_color(id, glm::vec3(1.0f, 0.0f, 0.0f));
+  EXPECT_FLOAT_EQ(batch.color(id).x, 1.0f);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(LineBatch, AddUpdateAndRemove) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::LineBatch batch;
+  auto a = batch.add(glm::vec3(1.0f, 0.0f, 0.0f), make_points(100));
+  auto b = batch.add(glm::vec3(0.0f, 1.0f, 0.0f), make_points(200));
+  EXPECT_NE(a, b);
+  EXPECT_EQ(batch.size(), 2u);
+
+  // Shrinking and growing members must not disturb the others.
+  EXPECT_NO_THROW(batch.update(a, make_points(50)));
+  EXPECT_NO_THROW(batch.update(a, make_points(5000)));
+  EXPECT_GE(batch.capacity(), 5200u);
+  EXPECT_EQ(batch.size(), 2u);
+
+  batch.remove(b);
+  EXPECT_FALSE(batch.contains(b));
+  EXPECT_TRUE(batch.contains(a));
+  EXPECT_EQ(batch.size(), 1u);
+
+  // Space released by removed members is reused before growing.
+  const auto capacity = batch.capacity();
+  batch.add(glm::vec3(0.0f, 0.0f, 1.0f), make_points(150));
+  EXPECT_EQ(batch.capacity(), capacity);
+
+  EXPECT_THROW(batch.remove(b), std::runtime_error);
+  EXPECT_THROW(batch.update(b, make_points(2)), std::runtime_error);
+  EXPECT_THROW(batch.color(b), std::runtime_error);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(LineBatch, Draw) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::LineBatch batch;
+  for (int k = 0; k < 1000; ++k) {
+    batch.add(glm::vec3(1.0f, 1.0f, 0.0f), make_points(1 + k % 20));
+  }
+
+  for (int i = 0; i < 3; i++) {
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    batch.render(nzl::TimePoint());
+
+    win.swap_buffers();
+  }
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(LineBatch, ColorPerMember) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  const int size = 64;
+  nzl::OffscreenTarget target(size, size);
+  std::vector<unsigned char> pixels;
+  target.set_sink([&](const nzl::OffscreenTarget::Frame& frame) {
+    pixels.assign(frame.pixels, frame.pixels + frame.size);
+  });
+
+  // Horizontal lines through the centers of rows 16, 32 and 48, each in its
+  // own color; the middle one is hidden.
+  const auto row = [&](int r) {
+    const float y = (r + 0.5f) / size * 2.0f - 1.0f;
+    return std::vector<glm::vec3>{{-1.0f, y, 0.0f}, {1.0f, y, 0.0f}};
+  };
+  nzl::LineBatch batch;
+  batch.add(glm::vec3(1.0f, 0.0f, 0.0f), row(16));
+  const auto hidden = batch.add(glm::vec3(0.0f, 1.0f, 0.0f), row(32));
+  const auto recolored = batch.add(glm::vec3(0.0f, 0.0f, 1.0f), row(48));
+  batch.set_visible(hidden, false);
+  batch.set_color(recolored, glm::vec3(1.0f, 1.0f, 0.0f));
+
+  target.bind();
+  glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+  glClear(GL_COLOR_BUFFER_BIT);
+  batch.render(nzl::TimePoint());
+  target.unbind();
+  target.capture();
+  target.flush();
+
+  ASSERT_EQ(pixels.size(), static_cast<std::size_t>(size * size * 4));
+  const auto pixel = [&](int r) {
+    const auto p = &pixels[(r * size + size / 2) * 4];
+    return glm::ivec3(p[0], p[1], p[2]);
+  };
+  EXPECT_EQ(pixel(16), glm::ivec3(255, 0, 0));
+  EXPECT_EQ(pixel(32), glm::ivec3(0, 0, 0));
+  EXPECT_EQ(pixel(48), glm::ivec3(255, 255, 0));
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(LineBatch, IndirectCommands) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::LineBatch batch;
+  const auto a = batch.add(glm::vec3(1.0f), make_points(10));
+  const auto b = batch.add(glm::vec3(1.0f), make_points(20));
+  const auto c = batch.add(glm::vec3(1.0f), make_points(30));
+  EXPECT_EQ(batch.number_of_commands(), 3u);
+  EXPECT_TRUE(batch.is_visible(b));
+
+  // Removed members leave an empty command, reused by the next member.
+  batch.remove(b);
+  EXPECT_EQ(batch.number_of_commands(), 3u);
+  const auto d = batch.add(glm::vec3(1.0f), make_points(40));
+  EXPECT_EQ(batch.number_of_commands(), 3u);
+
+  batch.set_visible(c, false);
+  EXPECT_FALSE(batch.is_visible(c));
+  EXPECT_TRUE(batch.is_visible(d));
+  EXPECT_THROW(batch.set_visible(b, true), std::runtime_error);
+
+  if (batch.is_indirect()) {
+    // Four unsigned integers per command: count, instances, first, base.
+    std::vector<unsigned int> commands(4 * batch.number_of_commands());
+    nzl::RenderState::current().bind_buffer(GL_DRAW_INDIRECT_BUFFER,
+                                            batch.command_buffer());
+    glGetBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0,
+                       commands.size() * sizeof(unsigned int),
+                       commands.data());
+    EXPECT_EQ(commands[0], 10u);
+    EXPECT_EQ(commands[1], 1u);
+    EXPECT_EQ(commands[4], 40u);
+    EXPECT_EQ(commands[5], 1u);
+    EXPECT_EQ(commands[8], 30u);
+    EXPECT_EQ(commands[9], 0u);
+
+    // The base instance of each command selects the color of its slot.
+    EXPECT_EQ(commands[3], 0u);
+    EXPECT_EQ(commands[7], 1u);
+    EXPECT_EQ(commands[11], 2u);
+  } else {
+    EXPECT_EQ(batch.command_buffer(), 0u);
+  }
+
+  // The batch is bounded by its members.
+  const auto bounds = batch.bounds();
+  ASSERT_TRUE(bounds.has_value());
+  EXPECT_FLOAT_EQ(bounds->minimum[0], -1.0);
+  EXPECT_FLOAT_EQ(bounds->maximum[1], 0.5);
+
+  batch.set_visible(a, false);
+  batch.render(nzl::TimePoint());
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
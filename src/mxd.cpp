@@ -13,6 +13,13 @@
 #include <sstream>
 #include <stdexcept>
 
+// mxd Library
+#include "frame_uniforms.hpp"
+#include "gpu_profiler.hpp"
+#include "program_cache.hpp"
+#include "render_state.hpp"
+#include "vertex_array.hpp"
+
 // OpenGL Libraries
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -35,7 +42,20 @@ void initialize() {
 #endif
 };
 
-void terminate() noexcept { glfwTerminate(); }
+void initialize_headless() {
+  initialize();
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+}
+
+void terminate() noexcept {
+  // Cached Programs die with their contexts.
+  ProgramCache::clear();
+  FrameUniforms::clear();
+  RenderState::clear();
+  GpuProfiler::clear();
+  VertexArray::clear();
+  glfwTerminate();
+}
 
 void requires_current_context() {
   if (glfwGetCurrentContext() == nullptr) {
@@ -16,6 +16,13 @@ namespace nzl {
 /// @throw std::runtime_error if initialization is not successful.
 void initialize();
 
+/// @brief Initialize mxd for rendering without a display.
+///
+/// Windows created afterwards are never shown, so their contexts can drive
+/// an OffscreenTarget on a server (e.g. under Xvfb, or Mesa's llvmpipe).
+/// @throw std::runtime_error if initialization is not successful.
+void initialize_headless();
+
 /// @brief Terminate mxd.
 void terminate() noexcept;
 
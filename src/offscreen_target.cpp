@@ -0,0 +1,301 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      offscreen_target.cpp
+/// @brief     Implementation of offscreen_target.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "offscreen_target.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// POSIX
+#include <unistd.h>
+
+// mxd Library
+#include "frame_uniforms.hpp"
+#include "mxd.hpp"
+#include "render_state.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace {  // anonymous namespace
+
+/// @brief Restores the read framebuffer binding on scope exit.
+class ReadFramebufferGuard {
+ public:
+  ReadFramebufferGuard() noexcept {
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &m_previous);
+  }
+  ~ReadFramebufferGuard() noexcept {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_previous);
+  }
+
+ private:
+  int m_previous{0};
+};
+
+}  // anonymous namespace
+
+namespace nzl {
+
+struct OffscreenTarget::OffscreenTargetImp {
+  int width;
+  int height;
+  int depth;
+  unsigned int fbo_id{0};
+  unsigned int color_id{0};
+  unsigned int depth_stencil_id{0};
+  int saved_viewport[4]{0, 0, 0, 0};
+
+  /// Ring of pixel buffers, their fences, and the frame each one holds.
+  std::vector<unsigned int> pbo_ids;
+  std::vector<GLsync> fences;
+  std::vector<std::uint64_t> frame_indices;
+  int next_slot{0};
+  int in_flight{0};
+
+  std::uint64_t captured{0};
+  std::uint64_t delivered{0};
+  OffscreenTarget::Sink sink;
+
+  OffscreenTargetImp(int width, int height, int depth);
+  ~OffscreenTargetImp() noexcept;
+
+  std::size_t frame_bytes() const noexcept {
+    return static_cast<std::size_t>(width) * height * 4;
+  }
+  int oldest_slot() const noexcept {
+    return (next_slot - in_flight + depth) % depth;
+  }
+
+  void queue_readback();
+  bool deliver_oldest(bool block);
+};
+
+OffscreenTarget::OffscreenTargetImp::OffscreenTargetImp(int width, int height,
+                                                        int depth)
+    : width{width}, height{height}, depth{std::max(depth, 2)} {
+  requires_current_context();
+
+  if (width <= 0 || height <= 0) {
+    std::ostringstream oss;
+    oss << "Cannot create a " << width << " x " << height
+        << " OffscreenTarget";
+    throw std::runtime_error(oss.str());
+  }
+
+  glGenRenderbuffers(1, &color_id);
+  glBindRenderbuffer(GL_RENDERBUFFER, color_id);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+  glGenRenderbuffers(1, &depth_stencil_id);
+  glBindRenderbuffer(GL_RENDERBUFFER, depth_stencil_id);
+  glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+  glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+  int previous_fbo{0};
+  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_fbo);
+  glGenFramebuffers(1, &fbo_id);
+  glBindFramebuffer(GL_FRAMEBUFFER, fbo_id);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                            GL_RENDERBUFFER, color_id);
+  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+                            GL_RENDERBUFFER, depth_stencil_id);
+  const auto status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+  glBindFramebuffer(GL_FRAMEBUFFER, previous_fbo);
+
+  if (status != GL_FRAMEBUFFER_COMPLETE) {
+    glDeleteFramebuffers(1, &fbo_id);
+    glDeleteRenderbuffers(1, &color_id);
+    glDeleteRenderbuffers(1, &depth_stencil_id);
+    std::ostringstream oss;
+    oss << "Error creating " << width << " x " << height
+        << " OffscreenTarget: framebuffer status 0x" << std::hex << status;
+    throw std::runtime_error(oss.str());
+  }
+
+  pbo_ids.resize(this->depth);
+  fences.resize(this->depth, nullptr);
+  frame_indices.resize(this->depth, 0);
+  glGenBuffers(this->depth, pbo_ids.data());
+  auto& state = RenderState::current();
+  for (auto&& pbo_id : pbo_ids) {
+    state.bind_buffer(GL_PIXEL_PACK_BUFFER, pbo_id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, frame_bytes(), nullptr, GL_STREAM_READ);
+  }
+
+  // A bound pack buffer redirects every glReadPixels, so it is never left
+  // bound.
+  state.bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+OffscreenTarget::OffscreenTargetImp::~OffscreenTargetImp() noexcept {
+  for (auto&& fence : fences) {
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+    }
+  }
+  auto& state = RenderState::current();
+  for (auto&& pbo_id : pbo_ids) {
+    state.forget_buffer(pbo_id);
+  }
+  glDeleteBuffers(depth, pbo_ids.data());
+  glDeleteFramebuffers(1, &fbo_id);
+  glDeleteRenderbuffers(1, &color_id);
+  glDeleteRenderbuffers(1, &depth_stencil_id);
+}
+
+void OffscreenTarget::OffscreenTargetImp::queue_readback() {
+  const auto slot = next_slot;
+
+  {
+    ReadFramebufferGuard guard;
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo_id);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+
+    // With a pack buffer bound, glReadPixels returns immediately and the copy
+    // happens on the GPU.
+    auto& state = RenderState::current();
+    state.bind_buffer(GL_PIXEL_PACK_BUFFER, pbo_ids[slot]);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    state.bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+
+  fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  frame_indices[slot] = captured++;
+  next_slot = (next_slot + 1) % depth;
+  ++in_flight;
+}
+
+bool OffscreenTarget::OffscreenTargetImp::deliver_oldest(bool block) {
+  if (in_flight == 0) {
+    return false;
+  }
+
+  const auto slot = oldest_slot();
+  auto& fence = fences[slot];
+  auto status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+  if (status == GL_TIMEOUT_EXPIRED && !block) {
+    return false;
+  }
+  while (status == GL_TIMEOUT_EXPIRED) {
+    status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+  }
+  glDeleteSync(fence);
+  fence = nullptr;
+  --in_flight;
+
+  auto& state = RenderState::current();
+  state.bind_buffer(GL_PIXEL_PACK_BUFFER, pbo_ids[slot]);
+  auto data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frame_bytes(),
+                               GL_MAP_READ_BIT);
+
+  // The buffer must be unmapped and unbound even if the Sink throws.
+  auto release = [&state](void*) {
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    state.bind_buffer(GL_PIXEL_PACK_BUFFER, 0);
+  };
+  std::unique_ptr<void, decltype(release)> mapping(data, release);
+
+  ++delivered;
+  if (sink && data != nullptr) {
+    OffscreenTarget::Frame frame;
+    frame.index = frame_indices[slot];
+    frame.width = width;
+    frame.height = height;
+    frame.pixels = static_cast<const unsigned char*>(data);
+    frame.size = frame_bytes();
+    sink(frame);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//         The section below forwards API calls to the implementation
+// -----------------------------------------------------------------------------
+
+OffscreenTarget::Sink OffscreenTarget::file_descriptor_sink(int fd) {
+  return [fd](const Frame& frame) {
+    auto data = frame.pixels;
+    auto remaining = frame.size;
+    while (remaining > 0) {
+      const auto written = ::write(fd, data, remaining);
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        std::ostringstream oss;
+        oss << "Error writing frame " << frame.index << " to file descriptor "
+            << fd << ": " << std::strerror(errno);
+        throw std::runtime_error(oss.str());
+      }
+      data += written;
+      remaining -= static_cast<std::size_t>(written);
+    }
+  };
+}
+
+OffscreenTarget::OffscreenTarget(int width, int height, int depth)
+    : m_pimpl{std::make_shared<OffscreenTargetImp>(width, height, depth)} {}
+
+int OffscreenTarget::width() const noexcept { return m_pimpl->width; }
+
+int OffscreenTarget::height() const noexcept { return m_pimpl->height; }
+
+int OffscreenTarget::depth() const noexcept { return m_pimpl->depth; }
+
+void OffscreenTarget::set_sink(Sink sink) { m_pimpl->sink = std::move(sink); }
+
+void OffscreenTarget::bind() {
+  glGetIntegerv(GL_VIEWPORT, m_pimpl->saved_viewport);
+  glBindFramebuffer(GL_FRAMEBUFFER, m_pimpl->fbo_id);
+  glViewport(0, 0, m_pimpl->width, m_pimpl->height);
+  FrameUniforms::update_viewport();
+}
+
+void OffscreenTarget::unbind() {
+  glBindFramebuffer(GL_FRAMEBUFFER, 0);
+  const auto& v = m_pimpl->saved_viewport;
+  glViewport(v[0], v[1], v[2], v[3]);
+  FrameUniforms::update_viewport();
+}
+
+void OffscreenTarget::capture() {
+  poll();
+  if (m_pimpl->in_flight == m_pimpl->depth) {
+    m_pimpl->deliver_oldest(true);
+  }
+  m_pimpl->queue_readback();
+}
+
+void OffscreenTarget::poll() {
+  while (m_pimpl->deliver_oldest(false)) {
+  }
+}
+
+void OffscreenTarget::flush() {
+  while (m_pimpl->deliver_oldest(true)) {
+  }
+}
+
+std::uint64_t OffscreenTarget::frames_captured() const noexcept {
+  return m_pimpl->captured;
+}
+
+std::uint64_t OffscreenTarget::frames_delivered() const noexcept {
+  return m_pimpl->delivered;
+}
+
+}  // namespace nzl
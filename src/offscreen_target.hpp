@@ -0,0 +1,111 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      offscreen_target.hpp
+/// @brief     Off-screen render target with asynchronous pixel readback.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace nzl {
+
+/// @brief A framebuffer that is rendered to instead of a Window, and whose
+/// frames are read back without stalling the render loop.
+///
+/// Frames are read into a ring of pixel buffers: capture() only queues the
+/// copy on the GPU, and a frame is handed to the sink once the GPU has
+/// finished it, typically one or two frames later. The render loop blocks
+/// only when every buffer in the ring is still in flight.
+///
+/// Any current context can be used, including that of a hidden Window (see
+/// initialize_headless()).
+///
+/// @note Requires a current context.
+class OffscreenTarget {
+ public:
+  /// @brief A frame read back from the target.
+  ///
+  /// Pixels are tightly packed RGBA, 8 bits per channel, with rows ordered
+  /// bottom to top as OpenGL stores them.
+  struct Frame {
+    std::uint64_t index{0};
+    int width{0};
+    int height{0};
+    const unsigned char* pixels{nullptr};
+    std::size_t size{0};
+  };
+
+  /// @brief Receives every frame, in capture order.
+  /// @note Frame::pixels is only valid during the call.
+  using Sink = std::function<void(const Frame&)>;
+
+  /// @brief Return a Sink that writes the raw pixels of every frame to a file
+  /// descriptor (e.g. a pipe into a video encoder).
+  /// @param fd Open file descriptor; it is not closed by the Sink.
+  /// @note The Sink throws std::runtime_error if a write fails.
+  static Sink file_descriptor_sink(int fd);
+
+  /// @brief Creates an off-screen target.
+  /// @param width Width in pixels.
+  /// @param height Height in pixels.
+  /// @param depth Number of frames that can be in flight (values below 2 are
+  /// raised to 2).
+  /// @throws std::runtime_error if the framebuffer cannot be created.
+  OffscreenTarget(int width, int height, int depth = 3);
+
+  /// @brief Return the width in pixels.
+  int width() const noexcept;
+
+  /// @brief Return the height in pixels.
+  int height() const noexcept;
+
+  /// @brief Return the number of frames that can be in flight.
+  int depth() const noexcept;
+
+  /// @brief Sets the Sink that receives the frames.
+  /// @param sink Function called once per captured frame.
+  /// @note Affects all copies of this object.
+  void set_sink(Sink sink);
+
+  /// @brief Direct rendering to this target and set the viewport to cover it.
+  void bind();
+
+  /// @brief Direct rendering back to the default framebuffer.
+  void unbind();
+
+  /// @brief Queue the readback of the current contents of the target.
+  ///
+  /// Frames the GPU has already finished are delivered to the Sink first. If
+  /// every buffer of the ring is in flight, blocks until the oldest one is
+  /// done.
+  /// @note Affects all copies of this object.
+  void capture();
+
+  /// @brief Deliver every finished frame without blocking.
+  /// @note Affects all copies of this object.
+  void poll();
+
+  /// @brief Wait for every frame in flight and deliver it.
+  /// @note Must be called before the target is destroyed, or the frames in
+  /// flight are lost.
+  void flush();
+
+  /// @brief Return the number of frames captured so far.
+  std::uint64_t frames_captured() const noexcept;
+
+  /// @brief Return the number of frames delivered to the Sink so far.
+  std::uint64_t frames_delivered() const noexcept;
+
+ private:
+  struct OffscreenTargetImp;
+  std::shared_ptr<OffscreenTargetImp> m_pimpl;
+};
+
+}  // namespace nzl
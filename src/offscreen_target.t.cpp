@@ -0,0 +1,142 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      offscreen_target.t.cpp
+/// @brief     Unit tests for offscreen_target.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "offscreen_target.hpp"
+
+// C++ Standard Library
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+// mxd Library
+#include "line.hpp"
+#include "mxd.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+TEST(OffscreenTarget, RequiresCurrentContext) {
+  EXPECT_THROW(nzl::OffscreenTarget(64, 32), std::runtime_error);
+}
+
+TEST(OffscreenTarget, ConstructorAndParameterAccess) {
+  nzl::initialize_headless();
+  nzl::Window win(100, 100, "Test Window");
+  win.make_current();
+
+  nzl::OffscreenTarget target(64, 32, 1);
+  EXPECT_EQ(target.width(), 64);
+  EXPECT_EQ(target.height(), 32);
+  EXPECT_EQ(target.depth(), 2);
+  EXPECT_EQ(target.frames_captured(), 0u);
+  EXPECT_EQ(target.frames_delivered(), 0u);
+
+  EXPECT_THROW(nzl::OffscreenTarget(0, 32), std::runtime_error);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(OffscreenTarget, FramesAreDeliveredInOrder) {
+  nzl::initialize_headless();
+  nzl::Window win(100, 100, "Test Window");
+  win.make_current();
+
+  const int width = 64;
+  const int height = 32;
+  nzl::OffscreenTarget target(width, height);
+
+  std::vector<std::uint64_t> indices;
+  std::vector<unsigned char> first_pixels;
+  target.set_sink([&](const nzl::OffscreenTarget::Frame& frame) {
+    EXPECT_EQ(frame.width, width);
+    EXPECT_EQ(frame.height, height);
+    EXPECT_EQ(frame.size, static_cast<std::size_t>(width * height * 4));
+    indices.push_back(frame.index);
+    first_pixels.assign(frame.pixels, frame.pixels + 4);
+  });
+
+  std::vector<glm::vec3> points{{-1.0f, 0.5f, 0.0f}, {1.0f, 0.5f, 0.0f}};
+  nzl::Line line(glm::vec3(0.0f, 1.0f, 0.0f), points);
+
+  const int frames = 10;
+  for (int i = 0; i < frames; i++) {
+    target.bind();
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    line.render(nzl::TimePoint());
+    target.unbind();
+    target.capture();
+
+    // No more frames than the ring holds are ever in flight.
+    EXPECT_LE(target.frames_captured() - target.frames_delivered(),
+              static_cast<std::uint64_t>(target.depth()));
+  }
+  target.flush();
+
+  EXPECT_EQ(target.frames_captured(), static_cast<std::uint64_t>(frames));
+  EXPECT_EQ(target.frames_delivered(), static_cast<std::uint64_t>(frames));
+  ASSERT_EQ(indices.size(), static_cast<std::size_t>(frames));
+  for (int i = 0; i < frames; i++) {
+    EXPECT_EQ(indices[i], static_cast<std::uint64_t>(i));
+  }
+
+  // The bottom-left pixel is away from the line, so it has the clear color.
+  ASSERT_EQ(first_pixels.size(), 4u);
+  EXPECT_EQ(first_pixels[0], 255);
+  EXPECT_EQ(first_pixels[1], 0);
+  EXPECT_EQ(first_pixels[2], 0);
+  EXPECT_EQ(first_pixels[3], 255);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(OffscreenTarget, FileDescriptorSink) {
+  nzl::initialize_headless();
+  nzl::Window win(100, 100, "Test Window");
+  win.make_current();
+
+  auto file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+
+  nzl::OffscreenTarget target(16, 8);
+  target.set_sink(nzl::OffscreenTarget::file_descriptor_sink(fileno(file)));
+
+  for (int i = 0; i < 5; i++) {
+    target.bind();
+    glClear(GL_COLOR_BUFFER_BIT);
+    target.unbind();
+    target.capture();
+  }
+  target.flush();
+
+  std::fseek(file, 0, SEEK_END);
+  EXPECT_EQ(std::ftell(file), 5 * 16 * 8 * 4);
+  std::fclose(file);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
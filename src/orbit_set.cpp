@@ -0,0 +1,205 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      orbit_set.cpp
+/// @brief     Implementation of orbit_set.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "orbit_set.hpp"
+
+// C++ Standard Library
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// mxd Library
+#include "program.hpp"
+#include "program_cache.hpp"
+#include "render_state.hpp"
+#include "shader.hpp"
+#include "shader_library.hpp"
+#include "time_point.hpp"
+#include "vertex_array.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+// The elements are uploaded as they are laid out in memory.
+static_assert(sizeof(nzl::OrbitSet::Elements) == 5 * sizeof(float),
+              "OrbitSet::Elements must be tightly packed");
+
+nzl::Program make_program() {
+  return nzl::ProgramCache::get(
+      {{nzl::Shader::Stage::Vertex,
+        nzl::ShaderLibrary::get("orbit_shader.vert")},
+       {nzl::Shader::Stage::Fragment,
+        nzl::ShaderLibrary::get("simple_shader.frag")}});
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+struct OrbitSet::OrbitSetImp {
+  nzl::Program program;
+  /// Revision of the program when its uniforms were looked up.
+  unsigned int program_revision{0};
+  nzl::UniformHandle<glm::vec3> color_uniform;
+  nzl::UniformHandle<int> number_of_points_uniform;
+  nzl::UniformHandle<glm::mat4> transform_uniform;
+  nzl::VertexArray vertex_array;
+  unsigned int vbo_id{0};
+  std::size_t size{0};
+  int number_of_points{0};
+  glm::vec3 color;
+  glm::mat4 transform{1.0f};
+
+  OrbitSetImp(glm::vec3 color, int number_of_points);
+  ~OrbitSetImp() noexcept;
+
+  void find_uniforms();
+  void layout();
+  void check_range(std::size_t first, std::size_t count) const;
+  void write(std::size_t first, const Elements* elements, std::size_t count);
+};
+
+OrbitSet::OrbitSetImp::OrbitSetImp(glm::vec3 color, int number_of_points)
+    : program{make_program()},
+      vertex_array{[this] { layout(); }},
+      number_of_points{number_of_points},
+      color{color} {
+  find_uniforms();
+  glGenBuffers(1, &vbo_id);
+}
+
+OrbitSet::OrbitSetImp::~OrbitSetImp() noexcept {
+  auto& state = RenderState::current();
+  state.forget_buffer(vbo_id);
+  glDeleteBuffers(1, &vbo_id);
+}
+
+void OrbitSet::OrbitSetImp::find_uniforms() {
+  program_revision = program.revision();
+  color_uniform = program.uniform<glm::vec3>("color");
+  number_of_points_uniform = program.uniform<int>("number_of_points");
+  transform_uniform = program.uniform<glm::mat4>("transform");
+}
+
+void OrbitSet::OrbitSetImp::layout() {
+  RenderState::current().bind_buffer(GL_ARRAY_BUFFER, vbo_id);
+
+  // One element set per instance: (a, e) in attribute 0, and (i, w, W) in
+  // attribute 1.
+  const auto stride = sizeof(Elements);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride,
+                        (void*)(2 * sizeof(float)));
+  glVertexAttribDivisor(0, 1);
+  glVertexAttribDivisor(1, 1);
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+}
+
+void OrbitSet::OrbitSetImp::check_range(std::size_t first,
+                                        std::size_t count) const {
+  if (first + count > size) {
+    std::ostringstream oss;
+    oss << "Cannot update orbits [" << first << ", " << first + count
+        << ") in an OrbitSet of size " << size;
+    throw std::runtime_error(oss.str());
+  }
+}
+
+void OrbitSet::OrbitSetImp::write(std::size_t first, const Elements* elements,
+                                  std::size_t count) {
+  RenderState::current().bind_buffer(GL_ARRAY_BUFFER, vbo_id);
+  glBufferSubData(GL_ARRAY_BUFFER, first * sizeof(Elements),
+                  count * sizeof(Elements), elements);
+}
+
+// -----------------------------------------------------------------------------
+//         The section below forwards API calls to the implementation
+// -----------------------------------------------------------------------------
+
+OrbitSet::OrbitSet(glm::vec3 color, int number_of_points)
+    : m_pimpl{std::make_shared<OrbitSetImp>(color, number_of_points)} {}
+
+OrbitSet::OrbitSet(glm::vec3 color, const std::vector<Elements>& elements,
+                   int number_of_points)
+    : OrbitSet(color, number_of_points) {
+  load_elements(elements);
+}
+
+void OrbitSet::load_elements(const std::vector<Elements>& elements) {
+  m_pimpl->size = elements.size();
+  RenderState::current().bind_buffer(GL_ARRAY_BUFFER, m_pimpl->vbo_id);
+  glBufferData(GL_ARRAY_BUFFER, elements.size() * sizeof(Elements),
+               elements.data(), GL_DYNAMIC_DRAW);
+}
+
+void OrbitSet::update(std::size_t first,
+                      const std::vector<Elements>& elements) {
+  m_pimpl->check_range(first, elements.size());
+  m_pimpl->write(first, elements.data(), elements.size());
+}
+
+void OrbitSet::update(std::size_t index, const Elements& elements) {
+  m_pimpl->check_range(index, 1);
+  m_pimpl->write(index, &elements, 1);
+}
+
+std::size_t OrbitSet::size() const noexcept { return m_pimpl->size; }
+
+int OrbitSet::number_of_points() const noexcept {
+  return m_pimpl->number_of_points;
+}
+
+void OrbitSet::set_number_of_points(int number_of_points) noexcept {
+  m_pimpl->number_of_points = number_of_points;
+}
+
+glm::vec3 OrbitSet::color() const noexcept { return m_pimpl->color; }
+
+void OrbitSet::set_color(glm::vec3 color) noexcept { m_pimpl->color = color; }
+
+void OrbitSet::set_transform(const glm::mat4& transform) noexcept {
+  m_pimpl->transform = transform;
+}
+
+const nzl::Program& OrbitSet::get_program() const noexcept {
+  return m_pimpl->program;
+}
+
+Geometry::DrawKey OrbitSet::do_draw_key() const noexcept {
+  return {m_pimpl->program.id(), m_pimpl->vertex_array.key(), false};
+}
+
+void OrbitSet::do_render(TimePoint t [[maybe_unused]]) {
+  if (m_pimpl->size == 0) {
+    return;
+  }
+
+  if (m_pimpl->program.revision() != m_pimpl->program_revision) {
+    m_pimpl->find_uniforms();
+  }
+
+  auto&& program = m_pimpl->program;
+  program.use();
+  program.set(m_pimpl->color_uniform, m_pimpl->color);
+  program.set(m_pimpl->number_of_points_uniform, m_pimpl->number_of_points);
+  program.set(m_pimpl->transform_uniform, m_pimpl->transform);
+
+  m_pimpl->vertex_array.bind();
+  glDrawArraysInstanced(GL_LINE_LOOP, 0, m_pimpl->number_of_points,
+                        static_cast<GLsizei>(m_pimpl->size));
+}
+
+}  // namespace nzl
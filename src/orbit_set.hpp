@@ -0,0 +1,114 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      orbit_set.hpp
+/// @brief     A set of Keplerian orbits drawn with a single instanced call.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// mxd Library
+#include "geometry.hpp"
+#include "program.hpp"
+#include "time_point.hpp"
+
+// Third party forward declaration headers
+#include <glm/fwd.hpp>
+
+namespace nzl {
+
+/// @brief A set of elliptical orbits described by their Keplerian elements.
+///
+/// The elements of every orbit are stored contiguously in a single buffer
+/// that is consumed as a per-instance vertex attribute. The vertex shader
+/// builds each orbit in 3D from its elements, so the whole set is rendered
+/// with one instanced draw call, and changing the elements of one orbit is a
+/// single buffer sub-update.
+class OrbitSet : public Geometry {
+ public:
+  /// @brief Keplerian elements of an elliptical orbit.
+  /// @note Angles are in radians. The true anomaly is not needed to draw the
+  /// orbit, so it is not part of the element set.
+  struct Elements {
+    float semimajor_axis{1.0f};
+    float eccentricity{0.0f};
+    float inclination{0.0f};
+    float argument_of_periapsis{0.0f};
+    float right_ascension{0.0f};
+  };
+
+  /// @brief Creates an empty OrbitSet.
+  /// @param color Color of the orbits.
+  /// @param number_of_points Number of points used to draw each orbit.
+  OrbitSet(glm::vec3 color, int number_of_points = 128);
+
+  /// @brief Creates an OrbitSet and loads the given orbits.
+  /// @param color Color of the orbits.
+  /// @param elements Elements of the orbits.
+  /// @param number_of_points Number of points used to draw each orbit.
+  OrbitSet(glm::vec3 color, const std::vector<Elements>& elements,
+           int number_of_points = 128);
+
+  /// @brief Replaces every orbit in the set.
+  /// @param elements Elements of the orbits.
+  /// @note Affects all copies of this object.
+  void load_elements(const std::vector<Elements>& elements);
+
+  /// @brief Replaces the elements of a contiguous range of orbits.
+  /// @param first Index of the first orbit to replace.
+  /// @param elements New elements of the orbits.
+  /// @throws std::runtime_error if the range exceeds the size of the set.
+  /// @note Affects all copies of this object.
+  void update(std::size_t first, const std::vector<Elements>& elements);
+
+  /// @brief Replaces the elements of one orbit.
+  /// @param index Index of the orbit to replace.
+  /// @param elements New elements of the orbit.
+  /// @throws std::runtime_error if @p index is out of range.
+  /// @note Affects all copies of this object.
+  void update(std::size_t index, const Elements& elements);
+
+  /// @brief Returns the number of orbits in the set.
+  std::size_t size() const noexcept;
+
+  /// @brief Returns the number of points used to draw each orbit.
+  int number_of_points() const noexcept;
+
+  /// @brief Sets the number of points used to draw each orbit.
+  /// @param number_of_points Number of points.
+  /// @note Affects all copies of this object.
+  void set_number_of_points(int number_of_points) noexcept;
+
+  /// @brief Returns the color of the orbits.
+  glm::vec3 color() const noexcept;
+
+  /// @brief Sets the color of the orbits.
+  /// @param color Color to be set.
+  /// @note Affects all copies of this object.
+  void set_color(glm::vec3 color) noexcept;
+
+  /// @brief Sets the transform applied to every orbit.
+  /// @param transform Matrix taking the inertial frame of the elements to
+  /// world coordinates (identity by default). The view and projection of the
+  /// frame (see FrameUniforms) are applied afterwards.
+  /// @note Affects all copies of this object.
+  void set_transform(const glm::mat4& transform) noexcept;
+
+  /// @brief Returns the program used by the set.
+  const nzl::Program& get_program() const noexcept;
+
+ private:
+  struct OrbitSetImp;
+  std::shared_ptr<OrbitSetImp> m_pimpl;
+
+  void do_render(TimePoint t) override;
+  DrawKey do_draw_key() const noexcept override;
+};
+
+}  // namespace nzl
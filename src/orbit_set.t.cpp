@@ -0,0 +1,129 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      orbit_set.t.cpp
+/// @brief     Unit tests for orbit_set.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "orbit_set.hpp"
+
+// C++ Standard Library
+#include <stdexcept>
+#include <vector>
+
+// mxd Library
+#include "mxd.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+std::vector<nzl::OrbitSet::Elements> make_elements(std::size_t size) {
+  std::vector<nzl::OrbitSet::Elements> elements(size);
+  for (auto k = 0u; k < size; ++k) {
+    elements[k].semimajor_axis = 0.2f + 0.7f * k / size;
+    elements[k].eccentricity = 0.9f * k / size;
+    elements[k].inclination = 3.14f * k / size;
+    elements[k].argument_of_periapsis = 0.1f * k;
+    elements[k].right_ascension = 0.2f * k;
+  }
+  return elements;
+}
+
+}  // anonymous namespace
+
+TEST(OrbitSet, ConstructorAndParameterAccess) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::OrbitSet empty(glm::vec3(0.4f, 0.5f, 0.3f));
+  EXPECT_EQ(empty.size(), 0u);
+  EXPECT_EQ(empty.number_of_points(), 128);
+  EXPECT_FLOAT_EQ(empty.color().x, 0.4f);
+  EXPECT_FLOAT_EQ(empty.color().y, 0.5f);
+  EXPECT_FLOAT_EQ(empty.color().z, 0.3f);
+  EXPECT_NE(empty.get_program().id(), 0u);
+
+  nzl::OrbitSet orbits(glm::vec3(1.0f, 1.0f, 0.0f), make_elements(10), 64);
+  EXPECT_EQ(orbits.size(), 10u);
+  EXPECT_EQ(orbits.number_of_points(), 64);
+
+  orbits.set_number_of_points(256);
+  EXPECT_EQ(orbits.number_of_points(), 256);
+
+  orbits.set_color(glm::vec3(1.0f, 0.0f, 0.0f));
+  EXPECT_FLOAT_EQ(orbits.color().x, 1.0f);
+  EXPECT_FLOAT_EQ(orbits.color().y, 0.0f);
+
+  // Orbits share their program.
+  EXPECT_EQ(orbits.get_program().id(), empty.get_program().id());
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(OrbitSet, UpdateAndOutOfRange) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::OrbitSet orbits(glm::vec3(1.0f, 1.0f, 0.0f), make_elements(100));
+
+  EXPECT_NO_THROW(orbits.update(10, make_elements(90)));
+  EXPECT_NO_THROW(orbits.update(99, nzl::OrbitSet::Elements()));
+  EXPECT_THROW(orbits.update(11, make_elements(90)), std::runtime_error);
+  EXPECT_THROW(orbits.update(100, nzl::OrbitSet::Elements()),
+               std::runtime_error);
+
+  orbits.load_elements(make_elements(20));
+  EXPECT_EQ(orbits.size(), 20u);
+  EXPECT_THROW(orbits.update(20, nzl::OrbitSet::Elements()),
+               std::runtime_error);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(OrbitSet, Draw) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::OrbitSet orbits(glm::vec3(0.0f, 1.0f, 1.0f), make_elements(10000));
+  orbits.set_transform(glm::mat4(1.0f));
+
+  for (int i = 0; i < 3; i++) {
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    orbits.update(i, nzl::OrbitSet::Elements());
+    orbits.render(nzl::TimePoint());
+
+    win.swap_buffers();
+  }
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
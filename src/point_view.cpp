@@ -0,0 +1,107 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      point_view.cpp
+/// @brief     Implementation of point_view.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "point_view.hpp"
+
+// C++ Standard Library
+#include <cstring>
+
+// Third party libraries
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+/// @brief Return the address of @p pointer as bytes.
+template <typename T>
+const unsigned char* bytes(const T* pointer) noexcept {
+  return reinterpret_cast<const unsigned char*>(pointer);
+}
+
+/// @brief Read a @p T at @p address, whatever its alignment.
+template <typename T>
+float read(const unsigned char* address) noexcept {
+  T value;
+  std::memcpy(&value, address, sizeof(T));
+  return static_cast<float>(value);
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+// An empty vector may have no storage; no offset is taken from a null data.
+PointView::PointView(const float* data, std::size_t size,
+                     std::size_t stride) noexcept
+    : PointView(data, data ? data + 1 : data, data ? data + 2 : data, size,
+                stride) {}
+
+PointView::PointView(const double* data, std::size_t size,
+                     std::size_t stride) noexcept
+    : PointView(data, data ? data + 1 : data, data ? data + 2 : data, size,
+                stride) {}
+
+PointView::PointView(const float* x, const float* y, const float* z,
+                     std::size_t size, std::size_t stride) noexcept
+    : m_components{bytes(x), bytes(y), bytes(z)},
+      m_size{size},
+      m_stride{stride},
+      m_is_double{false} {}
+
+PointView::PointView(const double* x, const double* y, const double* z,
+                     std::size_t size, std::size_t stride) noexcept
+    : m_components{bytes(x), bytes(y), bytes(z)},
+      m_size{size},
+      m_stride{stride},
+      m_is_double{true} {}
+
+PointView::PointView(const std::vector<glm::vec3>& points) noexcept
+    : PointView(reinterpret_cast<const float*>(points.data()), points.size(),
+                sizeof(glm::vec3)) {}
+
+PointView::PointView(const std::vector<glm::dvec3>& points) noexcept
+    : PointView(reinterpret_cast<const double*>(points.data()),
+                points.size(), sizeof(glm::dvec3)) {}
+
+std::size_t PointView::size() const noexcept { return m_size; }
+
+bool PointView::empty() const noexcept { return m_size == 0; }
+
+glm::vec3 PointView::operator[](std::size_t index) const noexcept {
+  const auto offset = index * m_stride;
+  glm::vec3 point;
+  for (int i = 0; i < 3; ++i) {
+    point[i] = m_is_double ? read<double>(m_components[i] + offset)
+                           : read<float>(m_components[i] + offset);
+  }
+  return point;
+}
+
+void PointView::copy(glm::vec3* output) const noexcept {
+  if (m_size == 0) {
+    return;
+  }
+  if (auto packed = data()) {
+    std::memcpy(output, packed, m_size * sizeof(glm::vec3));
+    return;
+  }
+  for (std::size_t k = 0; k < m_size; ++k) {
+    output[k] = (*this)[k];
+  }
+}
+
+const glm::vec3* PointView::data() const noexcept {
+  const bool is_packed =
+      !m_is_double && m_stride == sizeof(glm::vec3) &&
+      m_components[1] == m_components[0] + sizeof(float) &&
+      m_components[2] == m_components[1] + sizeof(float);
+  return is_packed ? reinterpret_cast<const glm::vec3*>(m_components[0])
+                   : nullptr;
+}
+
+}  // namespace nzl
@@ -0,0 +1,87 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      point_view.hpp
+/// @brief     Read-only view of points stored elsewhere, in any layout.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <vector>
+
+// Third party forward declaration only headers
+#include <glm/fwd.hpp>
+
+namespace nzl {
+
+/// @brief A const, non-owning view of a sequence of 3D points.
+///
+/// Coordinates may be floats or doubles, interleaved (x y z x y z ...) or in
+/// three separate arrays, and separated by any stride, so the state arrays of
+/// a propagator can be handed over without first copying them into a vector
+/// of glm::vec3. Points are converted to single precision as they are read.
+///
+/// @note The viewed memory must outlive the view.
+class PointView {
+ public:
+  /// @brief View interleaved coordinates.
+  /// @param data Coordinates of the first point (x, y, z, adjacent).
+  /// @param size Number of points.
+  /// @param stride Bytes from one point to the next (packed by default).
+  PointView(const float* data, std::size_t size,
+            std::size_t stride = 3 * sizeof(float)) noexcept;
+
+  /// @brief View interleaved double-precision coordinates (see above).
+  PointView(const double* data, std::size_t size,
+            std::size_t stride = 3 * sizeof(double)) noexcept;
+
+  /// @brief View coordinates held in three separate arrays.
+  /// @param x First x coordinate.
+  /// @param y First y coordinate.
+  /// @param z First z coordinate.
+  /// @param size Number of points.
+  /// @param stride Bytes from one coordinate to the next in each array.
+  PointView(const float* x, const float* y, const float* z, std::size_t size,
+            std::size_t stride = sizeof(float)) noexcept;
+
+  /// @brief View double-precision coordinates held in three separate arrays
+  /// (see above).
+  PointView(const double* x, const double* y, const double* z,
+            std::size_t size, std::size_t stride = sizeof(double)) noexcept;
+
+  /// @brief View a vector of points.
+  PointView(const std::vector<glm::vec3>& points) noexcept;
+
+  /// @brief View a vector of double-precision points.
+  PointView(const std::vector<glm::dvec3>& points) noexcept;
+
+  /// @brief Return the number of points.
+  std::size_t size() const noexcept;
+
+  /// @brief Return whether there are no points.
+  bool empty() const noexcept;
+
+  /// @brief Return a point, converted to single precision.
+  /// @param index Index of the point (not checked).
+  glm::vec3 operator[](std::size_t index) const noexcept;
+
+  /// @brief Write every point, converted to single precision, to @p output.
+  /// @param output Destination of size() points.
+  void copy(glm::vec3* output) const noexcept;
+
+  /// @brief Return the points if they are packed glm::vec3, else nullptr.
+  ///
+  /// Such a view needs no conversion at all.
+  const glm::vec3* data() const noexcept;
+
+ private:
+  const unsigned char* m_components[3];
+  std::size_t m_size;
+  std::size_t m_stride;
+  bool m_is_double;
+};
+
+}  // namespace nzl
@@ -0,0 +1,62 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      point_view.t.cpp
+/// @brief     Unit tests for point_view.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "point_view.hpp"
+
+// C++ Standard Library
+#include <vector>
+
+// mxd Library
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <glm/glm.hpp>
+
+TEST(PointView, Vectors) {
+  const std::vector<glm::vec3> points{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+  nzl::PointView view(points);
+  EXPECT_EQ(view.size(), 2u);
+  EXPECT_FALSE(view.empty());
+  EXPECT_EQ(view[1], points[1]);
+  EXPECT_EQ(view.data(), points.data());
+
+  const std::vector<glm::dvec3> precise{{1.0, 2.0, 3.0}, {4.5, 5.5, 6.5}};
+  nzl::PointView precise_view(precise);
+  EXPECT_EQ(precise_view[1], glm::vec3(4.5f, 5.5f, 6.5f));
+  EXPECT_EQ(precise_view.data(), nullptr);
+
+  EXPECT_TRUE(nzl::PointView(std::vector<glm::vec3>()).empty());
+}
+
+TEST(PointView, StridesAndSeparateArrays) {
+  // Positions interleaved with velocities, as in a propagator state.
+  const double states[] = {1.0, 2.0, 3.0, -1.0, -1.0, -1.0,
+                           4.0, 5.0, 6.0, -1.0, -1.0, -1.0};
+  nzl::PointView interleaved(states, 2, 6 * sizeof(double));
+  EXPECT_EQ(interleaved[0], glm::vec3(1.0f, 2.0f, 3.0f));
+  EXPECT_EQ(interleaved[1], glm::vec3(4.0f, 5.0f, 6.0f));
+
+  const float x[] = {1.0f, 4.0f};
+  const float y[] = {2.0f, 5.0f};
+  const float z[] = {3.0f, 6.0f};
+  nzl::PointView separate(x, y, z, 2);
+  EXPECT_EQ(separate.data(), nullptr);
+
+  std::vector<glm::vec3> output(2);
+  separate.copy(output.data());
+  EXPECT_EQ(output[0], interleaved[0]);
+  EXPECT_EQ(output[1], interleaved[1]);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
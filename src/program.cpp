@@ -10,6 +10,7 @@
 #include "program.hpp"
 
 // C++ Standard Library
+#include <algorithm>
 #include <exception>
 #include <map>
 #include <memory>
@@ -17,9 +18,13 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
 // mxd Library
+#include "frame_uniforms.hpp"
 #include "mxd.hpp"
+#include "render_state.hpp"
 
 // Third party libraries
 #include <GL/glew.h>
@@ -56,42 +61,138 @@ auto create_program() {
   }
 }
 
+/// @brief Return whether a uniform declared with GLSL @p type can be set with a
+/// value of type @p T.
+template <typename T>
+bool accepts(GLenum type) noexcept;
+
+template <>
+bool accepts<bool>(GLenum type) noexcept {
+  return type == GL_BOOL || type == GL_INT;
+}
+
+template <>
+bool accepts<int>(GLenum type) noexcept {
+  // Samplers are set through their texture unit, which is an int.
+  return type == GL_INT || type == GL_BOOL || type == GL_SAMPLER_1D ||
+         type == GL_SAMPLER_2D || type == GL_SAMPLER_3D ||
+         type == GL_SAMPLER_CUBE || type == GL_SAMPLER_BUFFER ||
+         type == GL_INT_SAMPLER_BUFFER ||
+         type == GL_UNSIGNED_INT_SAMPLER_BUFFER;
+}
+
+template <>
+bool accepts<float>(GLenum type) noexcept {
+  return type == GL_FLOAT;
+}
+
+template <>
+bool accepts<glm::vec2>(GLenum type) noexcept {
+  return type == GL_FLOAT_VEC2;
+}
+
+template <>
+bool accepts<glm::vec3>(GLenum type) noexcept {
+  return type == GL_FLOAT_VEC3;
+}
+
+template <>
+bool accepts<glm::vec4>(GLenum type) noexcept {
+  return type == GL_FLOAT_VEC4;
+}
+
+template <>
+bool accepts<glm::mat2>(GLenum type) noexcept {
+  return type == GL_FLOAT_MAT2;
+}
+
+template <>
+bool accepts<glm::mat3>(GLenum type) noexcept {
+  return type == GL_FLOAT_MAT3;
+}
+
+template <>
+bool accepts<glm::mat4>(GLenum type) noexcept {
+  return type == GL_FLOAT_MAT4;
+}
+
 }  // anonymous namespace
 
 namespace nzl {
 
 struct Program::IDContainer {
+  /// @brief Location and declared type of an active uniform.
+  struct Uniform {
+    int location;
+    GLenum type;
+  };
+
   const unsigned int m_id;
+  bool m_is_linking{false};
+  unsigned int m_revision{0};
 
   IDContainer(unsigned int id) noexcept : m_id{id} {}
 
-  ~IDContainer() noexcept { glDeleteProgram(m_id); }
+  ~IDContainer() noexcept {
+    RenderState::current().forget_program(m_id);
+    glDeleteProgram(m_id);
+  }
 
-  int find_uniform_location(const std::string& name) {
-    auto loc = m_u.find(name);
+  /// @brief Enumerate the active uniforms of the (linked) program, and
+  /// connect its Frame block (if any) to the FrameUniforms.
+  void introspect() {
+    m_u.clear();
 
-    if (loc != m_u.end()) {
-      return loc->second;
+    if (const auto index = glGetUniformBlockIndex(m_id, "Frame");
+        index != GL_INVALID_INDEX) {
+      glUniformBlockBinding(m_id, index, FrameUniforms::binding);
     }
 
-    m_u.insert(std::make_pair(name, create_uniform(name)));
-    return m_u.find(name)->second;
+    int count{0};
+    int max_length{0};
+    glGetProgramiv(m_id, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+
+    std::vector<char> buffer(std::max(max_length, 1));
+    for (int index = 0; index < count; ++index) {
+      int length{0};
+      int size{0};
+      GLenum type{0};
+      glGetActiveUniform(m_id, index, buffer.size(), &length, &size, &type,
+                         buffer.data());
+      std::string name(buffer.data(), length);
+
+      // Members of uniform blocks have no location.
+      const int location = glGetUniformLocation(m_id, name.c_str());
+      if (location < 0) {
+        continue;
+      }
+
+      // Arrays are reported as "name[0]"; make them reachable as "name" too.
+      if (const auto n = name.size();
+          n > 3 && name.compare(n - 3, 3, "[0]") == 0) {
+        m_u.emplace(name.substr(0, n - 3), Uniform{location, type});
+      }
+      m_u.emplace(std::move(name), Uniform{location, type});
+    }
   }
 
- private:
-  std::map<std::string, int> m_u;
-
-  int create_uniform(const std::string& name) {
-    int uniformLocation = glGetUniformLocation(m_id, name.c_str());
-    if (uniformLocation < 0) {
-      std::ostringstream oss;
+  const Uniform& find_uniform(std::string_view name) const {
+    if (auto loc = m_u.find(name); loc != m_u.end()) {
+      return loc->second;
+    }
 
-      oss << "Program " << m_id << " error, unable to find uniform: " << name;
+    std::ostringstream oss;
+    oss << "Program " << m_id << " error, unable to find uniform: " << name;
+    throw std::runtime_error(oss.str());
+  }
 
-      throw new std::runtime_error(oss.str());
-    }
-    return uniformLocation;
+  int find_uniform_location(std::string_view name) const {
+    return find_uniform(name).location;
   }
+
+ private:
+  std::map<std::string, Uniform, std::less<>> m_u;
 };
 
 Program::Program(std::vector<nzl::Shader> shaders)
@@ -102,73 +203,240 @@ Program::Program()
     : m_id_container{std::make_shared<IDContainer>(create_program())} {}
 
 void Program::compile() {
+  submit();
+  wait();
+}
+
+void Program::submit() {
   for (auto&& s : m_shaders) {
-    if (!s.is_compiled()) {
-      s.compile();
-    }
+    s.submit();
     glAttachShader(m_id_container->m_id, s.id());
   }
 
   glLinkProgram(m_id_container->m_id);
+  m_id_container->m_is_linking = true;
+}
+
+bool Program::is_ready() const noexcept {
+  if (!m_id_container->m_is_linking) {
+    return true;
+  }
+  if (!GLEW_KHR_parallel_shader_compile && !GLEW_ARB_parallel_shader_compile) {
+    return true;
+  }
+  int is_complete{GL_TRUE};
+  glGetProgramiv(m_id_container->m_id, GL_COMPLETION_STATUS_KHR, &is_complete);
+  return is_complete == GL_TRUE;
+}
+
+void Program::wait() {
+  if (!m_id_container->m_is_linking) {
+    return;
+  }
+
+  // Check the shaders first: their logs say more than a failed link. A failed
+  // link stays pending, so every later wait() reports it again.
+  for (auto&& s : m_shaders) {
+    s.compile();
+  }
   check_compilation_errors(m_id_container->m_id);
+  m_id_container->introspect();
+  m_id_container->m_is_linking = false;
+  ++m_id_container->m_revision;
+}
+
+void Program::relink(std::vector<nzl::Shader> shaders) {
+  for (auto&& s : shaders) {
+    s.submit();
+  }
+  for (auto&& s : shaders) {
+    s.compile();
+  }
+
+  for (auto&& s : m_shaders) {
+    glDetachShader(m_id_container->m_id, s.id());
+  }
+  m_shaders = std::move(shaders);
+  compile();
+}
+
+unsigned int Program::revision() const noexcept {
+  return m_id_container->m_revision;
+}
+
+Program::Binary Program::binary() const {
+  Binary binary;
+  if (!GLEW_ARB_get_program_binary) {
+    return binary;
+  }
+
+  int length{0};
+  glGetProgramiv(m_id_container->m_id, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length > 0) {
+    binary.data.resize(length);
+    GLenum format{0};
+    glGetProgramBinary(m_id_container->m_id, length, &length, &format,
+                       binary.data.data());
+    binary.data.resize(length);
+    binary.format = format;
+  }
+  return binary;
+}
+
+bool Program::load_binary(const Binary& binary) {
+  if (!GLEW_ARB_get_program_binary || binary.data.empty()) {
+    return false;
+  }
+
+  // Passing an unsupported format is a GL error rather than a failed link, so
+  // check the format first.
+  int count{0};
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &count);
+  std::vector<int> formats(count);
+  glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, formats.data());
+  if (std::find(formats.begin(), formats.end(),
+                static_cast<int>(binary.format)) == formats.end()) {
+    return false;
+  }
+
+  glProgramBinary(m_id_container->m_id, binary.format, binary.data.data(),
+                  binary.data.size());
+  m_id_container->m_is_linking = false;
+
+  int success{0};
+  glGetProgramiv(m_id_container->m_id, GL_LINK_STATUS, &success);
+  if (success == GL_FALSE) {
+    return false;
+  }
+
+  m_id_container->introspect();
+  ++m_id_container->m_revision;
+  return true;
 }
 
 unsigned int Program::id() const noexcept { return m_id_container->m_id; }
 
-void Program::use() const noexcept { glUseProgram(m_id_container->m_id); }
+void Program::use() const noexcept {
+  RenderState::current().use_program(m_id_container->m_id);
+}
 
 void Program::add_shader(nzl::Shader& shader) { m_shaders.push_back(shader); }
 
-void Program::set(const std::string& name, bool value) const {
+template <typename T>
+UniformHandle<T> Program::uniform(std::string_view name) const {
+  const auto& u = m_id_container->find_uniform(name);
+  if (!accepts<T>(u.type)) {
+    std::ostringstream oss;
+    oss << "Program " << m_id_container->m_id << " error, uniform " << name
+        << " has GLSL type 0x" << std::hex << u.type
+        << ", which does not match the requested handle type";
+    throw std::runtime_error(oss.str());
+  }
+  return UniformHandle<T>(u.location);
+}
+
+template UniformHandle<bool> Program::uniform(std::string_view) const;
+template UniformHandle<int> Program::uniform(std::string_view) const;
+template UniformHandle<float> Program::uniform(std::string_view) const;
+template UniformHandle<glm::vec2> Program::uniform(std::string_view) const;
+template UniformHandle<glm::vec3> Program::uniform(std::string_view) const;
+template UniformHandle<glm::vec4> Program::uniform(std::string_view) const;
+template UniformHandle<glm::mat2> Program::uniform(std::string_view) const;
+template UniformHandle<glm::mat3> Program::uniform(std::string_view) const;
+template UniformHandle<glm::mat4> Program::uniform(std::string_view) const;
+
+void Program::set(std::string_view name, bool value) const {
   glUniform1i(m_id_container->find_uniform_location(name), (int)value);
 }
 
-void Program::set(const std::string& name, int value) const {
+void Program::set(std::string_view name, int value) const {
   glUniform1i(m_id_container->find_uniform_location(name), value);
 }
 
-void Program::set(const std::string& name, float value) const {
+void Program::set(std::string_view name, float value) const {
   glUniform1f(m_id_container->find_uniform_location(name), value);
 }
 
-void Program::set(const std::string& name, float x, float y) const {
+void Program::set(std::string_view name, float x, float y) const {
   glUniform2f(m_id_container->find_uniform_location(name), x, y);
 }
 
-void Program::set(const std::string& name, float x, float y, float z) const {
+void Program::set(std::string_view name, float x, float y, float z) const {
   glUniform3f(m_id_container->find_uniform_location(name), x, y, z);
 }
 
-void Program::set(const std::string& name, float x, float y, float z,
+void Program::set(std::string_view name, float x, float y, float z,
                   float w) const {
   glUniform4f(m_id_container->find_uniform_location(name), x, y, z, w);
 }
 
-void Program::set(const std::string& name, const glm::vec2& value) const {
+void Program::set(std::string_view name, const glm::vec2& value) const {
   glUniform2fv(m_id_container->find_uniform_location(name), 1, &value[0]);
 }
 
-void Program::set(const std::string& name, const glm::vec3& value) const {
+void Program::set(std::string_view name, const glm::vec3& value) const {
   glUniform3fv(m_id_container->find_uniform_location(name), 1, &value[0]);
 }
 
-void Program::set(const std::string& name, const glm::vec4& value) const {
+void Program::set(std::string_view name, const glm::vec4& value) const {
   glUniform4fv(m_id_container->find_uniform_location(name), 1, &value[0]);
 }
 
-void Program::set(const std::string& name, const glm::mat2& value) const {
+void Program::set(std::string_view name, const glm::mat2& value) const {
   glUniformMatrix2fv(m_id_container->find_uniform_location(name), 1, GL_FALSE,
                      &value[0][0]);
 }
 
-void Program::set(const std::string& name, const glm::mat3& value) const {
+void Program::set(std::string_view name, const glm::mat3& value) const {
   glUniformMatrix3fv(m_id_container->find_uniform_location(name), 1, GL_FALSE,
                      &value[0][0]);
 }
 
-void Program::set(const std::string& name, const glm::mat4& value) const {
+void Program::set(std::string_view name, const glm::mat4& value) const {
   glUniformMatrix4fv(m_id_container->find_uniform_location(name), 1, GL_FALSE,
                      &value[0][0]);
 }
 
+void Program::set(UniformHandle<bool> handle, bool value) const noexcept {
+  glUniform1i(handle.m_location, (int)value);
+}
+
+void Program::set(UniformHandle<int> handle, int value) const noexcept {
+  glUniform1i(handle.m_location, value);
+}
+
+void Program::set(UniformHandle<float> handle, float value) const noexcept {
+  glUniform1f(handle.m_location, value);
+}
+
+void Program::set(UniformHandle<glm::vec2> handle,
+                  const glm::vec2& value) const noexcept {
+  glUniform2fv(handle.m_location, 1, &value[0]);
+}
+
+void Program::set(UniformHandle<glm::vec3> handle,
+                  const glm::vec3& value) const noexcept {
+  glUniform3fv(handle.m_location, 1, &value[0]);
+}
+
+void Program::set(UniformHandle<glm::vec4> handle,
+                  const glm::vec4& value) const noexcept {
+  glUniform4fv(handle.m_location, 1, &value[0]);
+}
+
+void Program::set(UniformHandle<glm::mat2> handle,
+                  const glm::mat2& value) const noexcept {
+  glUniformMatrix2fv(handle.m_location, 1, GL_FALSE, &value[0][0]);
+}
+
+void Program::set(UniformHandle<glm::mat3> handle,
+                  const glm::mat3& value) const noexcept {
+  glUniformMatrix3fv(handle.m_location, 1, GL_FALSE, &value[0][0]);
+}
+
+void Program::set(UniformHandle<glm::mat4> handle,
+                  const glm::mat4& value) const noexcept {
+  glUniformMatrix4fv(handle.m_location, 1, GL_FALSE, &value[0][0]);
+}
+
 }  // namespace nzl
@@ -10,6 +10,7 @@
 
 // C++ Standard Library
 #include <memory>
+#include <string_view>
 #include <vector>
 
 // mxd Library
@@ -20,8 +21,39 @@
 
 namespace nzl {
 
+class Program;
+
+/// @brief A reference to a uniform in a Program, resolved once at link time.
+/// @tparam T Type of the uniform (any type accepted by Program::set).
+///
+/// Setting a uniform through a UniformHandle is a single glUniform* call: the
+/// location was already looked up and type-checked when the handle was
+/// obtained from Program::uniform.
+template <typename T>
+class UniformHandle {
+ public:
+  /// @brief Creates a handle that refers to no uniform.
+  /// @note Setting a default-constructed handle is a no-op.
+  UniformHandle() noexcept = default;
+
+  /// @brief Return the location of the uniform within its Program.
+  int location() const noexcept { return m_location; }
+
+ private:
+  friend class Program;
+  explicit UniformHandle(int location) noexcept : m_location{location} {}
+
+  int m_location{-1};
+};
+
 class Program {
  public:
+  /// @brief Driver-specific binary representation of a linked Program.
+  struct Binary {
+    unsigned int format{0};
+    std::vector<char> data;
+  };
+
   /// @brief Create a Program from the given @link Shader Shaders@endlink.
   /// @param shaders Shaders to be used to create this Program.
   Program(std::vector<nzl::Shader> shaders);
@@ -32,42 +64,106 @@ class Program {
   /// @brief Links and compiles this Program.
   /// @throws std::runtime_error on compilation failure.
   /// @note If a shader in the vector is not compiled, the Program compiles it.
+  /// @note The active uniforms are enumerated once, after linking.
+  /// @note Equivalent to submit() followed by wait().
   void compile();
 
+  /// @brief Submits the shaders and the link of this Program to the driver,
+  /// without waiting for the result.
+  ///
+  /// Every query about a compilation (status, log, uniforms) blocks until the
+  /// driver finishes it. Submitting all the Programs needed at startup before
+  /// waiting on any lets the driver overlap their compilation, on several
+  /// threads when it supports KHR_parallel_shader_compile.
+  ///
+  /// @note Errors are reported by wait().
+  void submit();
+
+  /// @brief Returns whether the link started by submit() finished.
+  /// @note Never blocks. Without KHR_parallel_shader_compile the driver cannot
+  /// tell, and the result is always true.
+  /// @note Affects all copies of this object.
+  bool is_ready() const noexcept;
+
+  /// @brief Waits for the link started by submit() to finish.
+  /// @throws std::runtime_error on compilation or link failure. The failure is
+  /// kept, and every later call throws again until the Program is relinked.
+  /// @note Does nothing if no link is pending.
+  /// @note Affects all copies of this object.
+  void wait();
+
+  /// @brief Relinks this Program in place from new @link Shader
+  /// Shaders@endlink.
+  /// @param shaders Shaders that replace the current ones.
+  /// @throws std::runtime_error on compilation or link failure. A Shader that
+  /// fails to compile leaves the Program untouched.
+  /// @note The id does not change, so every copy keeps drawing with the new
+  /// code. Uniform locations may change; see revision().
+  /// @note Affects all copies of this object.
+  void relink(std::vector<nzl::Shader> shaders);
+
+  /// @brief Return the number of times this Program has been linked.
+  /// @note UniformHandles obtained at one revision may be stale at the next;
+  /// holders compare revisions to know when to obtain them again.
+  unsigned int revision() const noexcept;
+
+  /// @brief Return the binary representation of this (linked) Program.
+  /// @note The result is empty when the driver cannot provide a binary.
+  Binary binary() const;
+
+  /// @brief Links this Program from a binary previously returned by binary().
+  /// @param binary Binary representation of the Program.
+  /// @return Whether the driver accepted @p binary. Drivers reject binaries
+  /// produced by a different driver version; the Program is then left unlinked
+  /// and can still be built with compile().
+  bool load_binary(const Binary& binary);
+
   /// @brief Return an identifier associated with this Program.
   unsigned int id() const noexcept;
 
   /// @brief Calls glUseProgram() with this program's id
+  /// @note The call is elided when the program is already in use (see
+  /// RenderState).
   void use() const noexcept;
 
   /// @brief Adds a @link Shader@endlink to the program
   /// @param shader Shader to be added
   void add_shader(nzl::Shader& shader);
 
+  /// @brief Returns a handle to a uniform within the Program.
+  /// @tparam T Type of the uniform.
+  /// @param name Name of the uniform.
+  /// @throws std::runtime_error when the uniform is not found, or when its
+  /// declared type does not match @p T.
+  /// @note The handle remains valid for as long as the Program is not
+  /// re-linked.
+  template <typename T>
+  UniformHandle<T> uniform(std::string_view name) const;
+
   /// @brief Sets a boolean uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Boolean value to be set
-  void set(const std::string& name, bool value) const;
+  void set(std::string_view name, bool value) const;
 
   /// @brief Sets a int uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Integer value to be set
-  void set(const std::string& name, int value) const;
+  void set(std::string_view name, int value) const;
 
   /// @brief Sets a float uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Float value to be set
-  void set(const std::string& name, float value) const;
+  void set(std::string_view name, float value) const;
 
   /// @brief Sets a vec2 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param x First value of the vec2 to be set
   /// @param y Second value of the vec2 to be set
-  void set(const std::string& name, float x, float y) const;
+  void set(std::string_view name, float x, float y) const;
 
   /// @brief Sets a vec3 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
@@ -75,7 +171,7 @@ class Program {
   /// @param x First value of the vec3 to be set
   /// @param y Second value of the vec3 to be set
   /// @param z Third value of the vec3 to be set
-  void set(const std::string& name, float x, float y, float z) const;
+  void set(std::string_view name, float x, float y, float z) const;
 
   /// @brief Sets a vec4 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
@@ -84,43 +180,62 @@ class Program {
   /// @param y Second value of the vec4 to be set
   /// @param z Third value of the vec4 to be set
   /// @param w Fourth value of the vec4 to be set
-  void set(const std::string& name, float x, float y, float z, float w) const;
+  void set(std::string_view name, float x, float y, float z, float w) const;
 
   /// @brief Sets a vec2 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Vec2 to be set
-  void set(const std::string& name, const glm::vec2& value) const;
+  void set(std::string_view name, const glm::vec2& value) const;
 
   /// @brief Sets a vec3 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Vec3 to be set
-  void set(const std::string& name, const glm::vec3& value) const;
+  void set(std::string_view name, const glm::vec3& value) const;
 
   /// @brief Sets a vec4 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Vec4 to be set
-  void set(const std::string& name, const glm::vec4& value) const;
+  void set(std::string_view name, const glm::vec4& value) const;
 
   /// @brief Sets a mat2 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Mat2 to be set
-  void set(const std::string& name, const glm::mat2& value) const;
+  void set(std::string_view name, const glm::mat2& value) const;
 
   /// @brief Sets a mat3 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Mat3 to be set
-  void set(const std::string& name, const glm::mat3& value) const;
+  void set(std::string_view name, const glm::mat3& value) const;
 
   /// @brief Sets a mat4 uniform within the Program.
   /// @throws std::runtime_error when uniform not found
   /// @param name Name of the uniform
   /// @param value Mat4 to be set
-  void set(const std::string& name, const glm::mat4& value) const;
+  void set(std::string_view name, const glm::mat4& value) const;
+
+  /// @brief Sets a uniform through a handle obtained from uniform().
+  /// @param handle Handle to the uniform
+  /// @param value Value to be set
+  void set(UniformHandle<bool> handle, bool value) const noexcept;
+  void set(UniformHandle<int> handle, int value) const noexcept;
+  void set(UniformHandle<float> handle, float value) const noexcept;
+  void set(UniformHandle<glm::vec2> handle,
+           const glm::vec2& value) const noexcept;
+  void set(UniformHandle<glm::vec3> handle,
+           const glm::vec3& value) const noexcept;
+  void set(UniformHandle<glm::vec4> handle,
+           const glm::vec4& value) const noexcept;
+  void set(UniformHandle<glm::mat2> handle,
+           const glm::mat2& value) const noexcept;
+  void set(UniformHandle<glm::mat3> handle,
+           const glm::mat3& value) const noexcept;
+  void set(UniformHandle<glm::mat4> handle,
+           const glm::mat4& value) const noexcept;
 
  private:
   struct IDContainer;
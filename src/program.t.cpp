@@ -10,6 +10,7 @@
 #include "program.hpp"
 
 // C++ Standard Library
+#include <stdexcept>
 #include <vector>
 
 // mxd Library
@@ -488,6 +489,165 @@ TEST(Program, Mat4Uniform) {
   nzl::terminate();
 }
 
+TEST(Program, MissingUniformThrows) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Program program{create_uniform_test_program()};
+
+  program.use();
+  EXPECT_THROW(program.set("notAUniform", 1.0f), std::runtime_error);
+  EXPECT_THROW(program.uniform<float>("notAUniform"), std::runtime_error);
+
+  nzl::terminate();
+}
+
+TEST(Program, UniformHandle) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Program program{create_uniform_test_program()};
+
+  auto handle = program.uniform<glm::vec3>("testVec3");
+  EXPECT_EQ(handle.location(),
+            glGetUniformLocation(program.id(), "testVec3"));
+
+  glm::vec3 value(123.312f, 7567.4f, 1565.2f);
+
+  program.use();
+  program.set(handle, value);
+
+  glm::vec3 ret;
+
+  glGetnUniformfv(program.id(), handle.location(), 3 * sizeof(float),
+                  &ret[0]);
+
+  EXPECT_FLOAT_EQ(ret.x, value.x);
+  EXPECT_FLOAT_EQ(ret.y, value.y);
+  EXPECT_FLOAT_EQ(ret.z, value.z);
+
+  // Handles are shared by copies of the Program.
+  nzl::Program copy = program;
+  EXPECT_EQ(copy.uniform<glm::vec3>("testVec3").location(), handle.location());
+
+  nzl::terminate();
+}
+
+TEST(Program, UniformHandleTypeMismatchThrows) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Program program{create_uniform_test_program()};
+
+  EXPECT_THROW(program.uniform<glm::vec4>("testVec3"), std::runtime_error);
+  EXPECT_THROW(program.uniform<float>("testMat4"), std::runtime_error);
+  EXPECT_NO_THROW(program.uniform<bool>("testInt"));
+  EXPECT_NO_THROW(program.uniform<int>("testInt"));
+
+  nzl::terminate();
+}
+
+TEST(Program, DefaultUniformHandleIsNoOp) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Program program{create_uniform_test_program()};
+
+  nzl::UniformHandle<float> handle;
+  EXPECT_EQ(handle.location(), -1);
+
+  program.use();
+  program.set(handle, 1.0f);
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(Program, BinaryRoundTrip) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Program program{create_uniform_test_program()};
+  auto binary = program.binary();
+
+  nzl::Program reloaded;
+  if (binary.data.empty()) {
+    // The driver does not support program binaries.
+    EXPECT_FALSE(reloaded.load_binary(binary));
+  } else {
+    ASSERT_TRUE(reloaded.load_binary(binary));
+    EXPECT_NO_THROW(reloaded.uniform<glm::mat4>("testMat4"));
+  }
+
+  // Garbage is rejected without raising OpenGL errors.
+  nzl::Program::Binary garbage{binary.format, std::vector<char>(64, 'x')};
+  nzl::Program rejected;
+  EXPECT_FALSE(rejected.load_binary(garbage));
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(Program, SubmitAndWait) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  std::string vSource =
+      "#version 330\n"
+      "layout (location = 0) in vec3 aPos;\n"
+      "uniform float scale;\n"
+      "void main() {\n"
+      "gl_Position = vec4(scale * aPos, 1.0);}";
+
+  std::string fSource =
+      "#version 330\n"
+      "out vec4 FragColor;\n"
+      "void main(){\n"
+      "FragColor = vec4(1.0);}";
+
+  // Submit every Program before waiting on any.
+  std::vector<nzl::Program> programs;
+  for (int k = 0; k < 8; ++k) {
+    programs.emplace_back(std::vector<nzl::Shader>{
+        nzl::Shader(nzl::Shader::Stage::Vertex, vSource),
+        nzl::Shader(nzl::Shader::Stage::Fragment, fSource)});
+    programs.back().submit();
+  }
+
+  for (auto&& program : programs) {
+    EXPECT_NO_THROW(program.wait());
+    EXPECT_TRUE(program.is_ready());
+    EXPECT_NO_THROW(program.uniform<float>("scale"));
+  }
+
+  // Errors surface when waiting, not when submitting.
+  nzl::Program wrong(
+      {nzl::Shader(nzl::Shader::Stage::Vertex, "void main() { x }"),
+       nzl::Shader(nzl::Shader::Stage::Fragment, fSource)});
+  EXPECT_NO_THROW(wrong.submit());
+  EXPECT_THROW(wrong.wait(), std::runtime_error);
+
+  // The failure is not forgotten by the next wait.
+  EXPECT_THROW(wrong.wait(), std::runtime_error);
+  EXPECT_THROW(wrong.uniform<float>("scale"), std::runtime_error);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
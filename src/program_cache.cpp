@@ -0,0 +1,428 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      program_cache.cpp
+/// @brief     Implementation of program_cache.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "program_cache.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// mxd Library
+#include "mxd.hpp"
+#include "program.hpp"
+#include "render_state.hpp"
+#include "shader.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace {  // anonymous namespace
+
+using Sources = std::vector<nzl::ProgramCache::Source>;
+
+/// @brief 64-bit FNV-1a hash of @p text.
+std::uint64_t fnv1a(std::string_view text) noexcept {
+  std::uint64_t hash = 0xcbf29ce484222325ull;
+  for (auto c : text) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+/// @brief Programs are only valid within the share group in which they were
+/// created, so the group is part of the key.
+using Key = std::pair<GLFWwindow*, std::vector<std::pair<int, std::uint64_t>>>;
+
+struct Entry {
+  Sources sources;
+  nzl::Program program;
+};
+
+std::mutex& cache_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::map<Key, Entry>& cache() {
+  static std::map<Key, Entry> entries;
+  return entries;
+}
+
+std::string& binary_directory_path() {
+  static std::string directory;
+  return directory;
+}
+
+/// @brief Return the sources in a canonical (sorted) order, so the order in
+/// which stages are listed does not affect the key.
+Sources canonical(Sources sources) {
+  std::sort(sources.begin(), sources.end());
+  return sources;
+}
+
+Key make_key(const Sources& sources) {
+  Key key{nzl::RenderState::share_group(glfwGetCurrentContext()), {}};
+  for (auto&& [stage, source] : sources) {
+    key.second.emplace_back(static_cast<int>(stage), fnv1a(source));
+  }
+  return key;
+}
+
+/// @brief Create a Program from @p sources and submit it (see
+/// Program::submit); the caller must wait() on it before use.
+nzl::Program submit(const Sources& sources, bool retrievable) {
+  std::vector<nzl::Shader> shaders;
+  for (auto&& [stage, source] : sources) {
+    shaders.emplace_back(stage, source);
+  }
+  nzl::Program program(shaders);
+  if (retrievable) {
+    glProgramParameteri(program.id(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                        GL_TRUE);
+  }
+  program.submit();
+  return program;
+}
+
+/// @brief Describe a Program built from @p sources by the current driver.
+/// @note Binaries are only valid for the driver that produced them.
+std::string binary_identity(const Sources& sources) {
+  auto text = [](GLenum name) {
+    auto value = reinterpret_cast<const char*>(glGetString(name));
+    return value ? std::string(value) : std::string();
+  };
+
+  std::ostringstream oss;
+  oss << text(GL_VENDOR) << "\n"
+      << text(GL_RENDERER) << "\n"
+      << text(GL_VERSION) << "\n";
+  for (auto&& [stage, source] : sources) {
+    oss << static_cast<int>(stage) << ":" << std::hex << fnv1a(source) << "\n";
+  }
+  return oss.str();
+}
+
+std::filesystem::path binary_path(const std::string& directory,
+                                  const std::string& identity) {
+  std::ostringstream oss;
+  oss << std::hex << std::setw(16) << std::setfill('0') << fnv1a(identity)
+      << ".bin";
+  return std::filesystem::path(directory) / oss.str();
+}
+
+/// @brief Tag at the start of every binary file.
+const char binary_magic[8] = {'M', 'X', 'D', 'P', 'R', 'O', 'G', '1'};
+
+/// @brief Read a binary stored by write_binary.
+/// @return Whether the file exists, is well-formed, and matches @p identity.
+bool read_binary(const std::filesystem::path& path, const std::string& identity,
+                 nzl::Program::Binary& binary) {
+  std::ifstream fp(path, std::ios::in | std::ios::binary);
+  if (!fp.good()) {
+    return false;
+  }
+
+  char magic[sizeof(binary_magic)];
+  std::uint64_t identity_size{0};
+  fp.read(magic, sizeof(magic));
+  fp.read(reinterpret_cast<char*>(&identity_size), sizeof(identity_size));
+  if (!fp.good() || !std::equal(magic, magic + sizeof(magic), binary_magic) ||
+      identity_size != identity.size()) {
+    return false;
+  }
+
+  std::string stored_identity(identity_size, '\0');
+  fp.read(stored_identity.data(), stored_identity.size());
+  if (!fp.good() || stored_identity != identity) {
+    return false;
+  }
+
+  std::uint64_t size{0};
+  fp.read(reinterpret_cast<char*>(&binary.format), sizeof(binary.format));
+  fp.read(reinterpret_cast<char*>(&size), sizeof(size));
+  if (!fp.good()) {
+    return false;
+  }
+  binary.data.resize(size);
+  fp.read(binary.data.data(), binary.data.size());
+  return fp.good();
+}
+
+/// @brief Store a binary so that read_binary can find it.
+/// @note Failures are ignored: the on-disk cache is an optimization only.
+void write_binary(const std::filesystem::path& path,
+                  const std::string& identity,
+                  const nzl::Program::Binary& binary) {
+  if (binary.data.empty()) {
+    return;
+  }
+
+  std::error_code error;
+  std::filesystem::create_directories(path.parent_path(), error);
+
+  // Write to a temporary file and rename it, so that a concurrent reader
+  // never sees a partially written binary.
+  auto temporary = path;
+  temporary += ".tmp";
+  {
+    std::ofstream fp(temporary, std::ios::out | std::ios::binary);
+    const std::uint64_t identity_size = identity.size();
+    const std::uint64_t size = binary.data.size();
+    fp.write(binary_magic, sizeof(binary_magic));
+    fp.write(reinterpret_cast<const char*>(&identity_size),
+             sizeof(identity_size));
+    fp.write(identity.data(), identity.size());
+    fp.write(reinterpret_cast<const char*>(&binary.format),
+             sizeof(binary.format));
+    fp.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    fp.write(binary.data.data(), binary.data.size());
+    if (!fp.good()) {
+      fp.close();
+      std::filesystem::remove(temporary, error);
+      return;
+    }
+  }
+  std::filesystem::rename(temporary, path, error);
+}
+
+bool uses_binaries(const std::string& directory) {
+  return !directory.empty() && GLEW_ARB_get_program_binary;
+}
+
+/// @brief Link a Program from its on-disk binary if possible, otherwise submit
+/// it for compilation.
+/// @param is_linked Set to whether the Program was linked from its binary;
+/// otherwise it must be passed to finish().
+nzl::Program start(const Sources& sources, const std::string& directory,
+                   bool& is_linked) {
+  is_linked = false;
+  if (!uses_binaries(directory)) {
+    return submit(sources, false);
+  }
+
+  const auto identity = binary_identity(sources);
+  if (nzl::Program::Binary binary;
+      read_binary(binary_path(directory, identity), identity, binary)) {
+    nzl::Program program;
+    if (program.load_binary(binary)) {
+      is_linked = true;
+      return program;
+    }
+  }
+  return submit(sources, true);
+}
+
+/// @brief Wait for a Program returned by start() and store its binary for the
+/// next run.
+void finish(const Sources& sources, const std::string& directory,
+            nzl::Program& program) {
+  program.wait();
+  if (uses_binaries(directory)) {
+    const auto identity = binary_identity(sources);
+    write_binary(binary_path(directory, identity), identity, program.binary());
+  }
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+Program ProgramCache::get(const std::vector<Source>& sources) {
+  return get_all({sources}).front();
+}
+
+std::vector<Program> ProgramCache::get_all(
+    const std::vector<std::vector<Source>>& requests) {
+  nzl::requires_current_context();
+
+  struct Request {
+    Sources sources;
+    Key key;
+    std::optional<Program> program;
+    bool is_linked{true};
+    bool is_cacheable{true};
+  };
+
+  std::vector<Request> pending;
+  pending.reserve(requests.size());
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex());
+    directory = binary_directory_path();
+    for (auto&& unsorted_sources : requests) {
+      auto sources = canonical(unsorted_sources);
+      auto key = make_key(sources);
+      auto& request = pending.emplace_back(Request{sources, key, {}});
+      if (auto it = cache().find(key); it != cache().end()) {
+        if (it->second.sources == sources) {
+          request.program = it->second.program;
+        } else {
+          // Hash collision: build a fresh Program but leave the cache alone.
+          request.is_cacheable = false;
+        }
+      }
+    }
+  }
+
+  // Start every missing Program before waiting on any, so the driver can
+  // overlap their compilation. Compile without the lock, so that a compilation
+  // on one thread (e.g. an Uploader) never stalls lookups on another.
+  for (auto&& request : pending) {
+    if (request.program) {
+      continue;
+    }
+    if (request.is_cacheable) {
+      request.program = start(request.sources, directory, request.is_linked);
+    } else {
+      request.program = submit(request.sources, false);
+      request.is_linked = false;
+    }
+  }
+
+  std::vector<Program> programs;
+  programs.reserve(pending.size());
+  for (auto&& request : pending) {
+    if (!request.is_linked) {
+      if (request.is_cacheable) {
+        finish(request.sources, directory, *request.program);
+      } else {
+        request.program->wait();
+      }
+    }
+    programs.push_back(*request.program);
+  }
+
+  // If two threads race to build the same Program, the first one cached wins.
+  std::lock_guard<std::mutex> lock(cache_mutex());
+  for (std::size_t k = 0; k < pending.size(); ++k) {
+    if (!pending[k].is_cacheable) {
+      continue;
+    }
+    auto [it, is_inserted] = cache().emplace(
+        std::move(pending[k].key), Entry{pending[k].sources, programs[k]});
+    if (!is_inserted && it->second.sources == pending[k].sources) {
+      programs[k] = it->second.program;
+    }
+  }
+  return programs;
+}
+
+std::size_t ProgramCache::relink(const std::string& old_source,
+                                 const std::string& new_source) {
+  nzl::requires_current_context();
+  if (old_source == new_source) {
+    return 0;
+  }
+
+  const auto group = RenderState::share_group(glfwGetCurrentContext());
+  std::size_t count{0};
+
+  // Relinking is rare (a developer saved a shader), so it holds the lock.
+  std::lock_guard<std::mutex> lock(cache_mutex());
+  for (auto it = cache().begin(); it != cache().end();) {
+    auto sources = it->second.sources;
+    bool is_affected{false};
+    for (auto&& [stage, source] : sources) {
+      if (source == old_source) {
+        source = new_source;
+        is_affected = true;
+      }
+    }
+    if (it->first.first != group || !is_affected) {
+      ++it;
+      continue;
+    }
+
+    sources = canonical(std::move(sources));
+    std::vector<Shader> shaders;
+    for (auto&& [stage, source] : sources) {
+      shaders.emplace_back(stage, source);
+    }
+    auto program = it->second.program;
+    program.relink(std::move(shaders));
+
+    // The entry moves to the key of its new sources. It no longer contains
+    // old_source, so the loop skips it should it land further ahead.
+    it = cache().erase(it);
+    cache().emplace(make_key(sources), Entry{sources, program});
+    ++count;
+  }
+  return count;
+}
+
+void ProgramCache::set_binary_directory(std::string directory) {
+  std::lock_guard<std::mutex> lock(cache_mutex());
+  binary_directory_path() = std::move(directory);
+}
+
+std::string ProgramCache::binary_directory() {
+  std::lock_guard<std::mutex> lock(cache_mutex());
+  return binary_directory_path();
+}
+
+std::size_t ProgramCache::size() noexcept {
+  std::lock_guard<std::mutex> lock(cache_mutex());
+  return cache().size();
+}
+
+void ProgramCache::release(GLFWwindow* context) noexcept {
+  if (RenderState::share_group(context) != context) {
+    return;
+  }
+  const auto successor = RenderState::successor(context);
+
+  std::vector<Entry> orphans;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex());
+    for (auto it = cache().begin(); it != cache().end();) {
+      if (it->first.first != context) {
+        ++it;
+        continue;
+      }
+      auto node = cache().extract(it++);
+      if (successor != nullptr) {
+        node.key().first = successor;
+        cache().insert(std::move(node));
+      } else {
+        orphans.push_back(std::move(node.mapped()));
+      }
+    }
+  }
+  if (orphans.empty()) {
+    return;
+  }
+
+  // Programs are deleted in the context they belong to, never in whichever
+  // unrelated context happens to be current.
+  const auto previous = glfwGetCurrentContext();
+  glfwMakeContextCurrent(context);
+  orphans.clear();
+  glfwMakeContextCurrent(previous);
+}
+
+void ProgramCache::clear() noexcept {
+  std::lock_guard<std::mutex> lock(cache_mutex());
+  cache().clear();
+}
+
+}  // namespace nzl
@@ -0,0 +1,110 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      program_cache.hpp
+/// @brief     Process-wide cache of linked @link Program Programs@endlink.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+// mxd Library
+#include "program.hpp"
+#include "shader.hpp"
+
+// GLFW context handle (declared here to keep GLFW out of mxd headers).
+struct GLFWwindow;
+
+namespace nzl {
+
+/// @brief Process-wide cache that deduplicates identical @link Program
+/// Programs@endlink.
+///
+/// Programs are keyed by the set of (stage, source hash) pairs of their
+/// shaders and by the share group of the OpenGL context in which they were
+/// created (see RenderState::share_group). The first request for a given set
+/// of sources compiles and links a Program; every subsequent request returns
+/// a copy of that same Program (copies share the underlying OpenGL object).
+/// Sources are passed as text rather than as Shader objects so that a cache
+/// hit creates no OpenGL objects at all.
+class ProgramCache {
+ public:
+  /// @brief Source code for one stage of a Program.
+  using Source = std::pair<Shader::Stage, std::string>;
+
+  /// @brief Return a linked Program built from the given sources.
+  /// @param sources Source code for every stage of the Program.
+  /// @throws std::runtime_error if compilation or linking fails.
+  /// @note Requires a current context.
+  static Program get(const std::vector<Source>& sources);
+
+  /// @brief Return linked Programs built from each set of sources.
+  /// @param requests Source code for every stage of each Program.
+  /// @return One Program per element of @p requests, in the same order.
+  /// @throws std::runtime_error if compilation or linking fails.
+  /// @note Requires a current context.
+  ///
+  /// Equivalent to calling get() for each set of sources, except that every
+  /// missing Program is submitted (see Program::submit) before waiting on any,
+  /// so the driver overlaps their compilation. Prefer it to warm the cache
+  /// with all the shader variants needed at startup.
+  static std::vector<Program> get_all(
+      const std::vector<std::vector<Source>>& requests);
+
+  /// @brief Relink, in place, every cached Program of the current share group
+  /// that has a stage with the source @p old_source, using @p new_source for
+  /// that stage instead.
+  /// @return Number of Programs relinked.
+  /// @throws std::runtime_error if a compilation or link fails.
+  /// @note Requires a current context.
+  ///
+  /// Copies of the relinked Programs held elsewhere (e.g. by geometries) keep
+  /// their id and draw with the new code, and get() with the new sources
+  /// returns them. Used by ShaderLibrary::reload.
+  static std::size_t relink(const std::string& old_source,
+                            const std::string& new_source);
+
+  /// @brief Enable the on-disk cache of program binaries.
+  /// @param directory Directory in which binaries are stored (created when
+  /// needed). An empty string disables the on-disk cache, which is the
+  /// default.
+  ///
+  /// When enabled, a Program missing from the in-memory cache is first looked
+  /// up on disk and linked straight from its binary (glProgramBinary), which
+  /// skips compilation altogether. Binaries are keyed by the sources and by the
+  /// vendor, renderer, and version strings of the driver; a binary the driver
+  /// rejects is transparently replaced by a full compilation.
+  ///
+  /// @note Binaries require OpenGL 4.1 or ARB_get_program_binary; without
+  /// them the on-disk cache is silently bypassed.
+  static void set_binary_directory(std::string directory);
+
+  /// @brief Return the directory of the on-disk cache (empty if disabled).
+  static std::string binary_directory();
+
+  /// @brief Return the number of Programs in the cache.
+  static std::size_t size() noexcept;
+
+  /// @brief Release the Programs of a context about to be destroyed.
+  /// @param context Context about to be destroyed.
+  ///
+  /// The Programs of a share group outlive any one of its contexts: if
+  /// @p context is the first context of its group, they move to the context
+  /// that takes the group over (see RenderState::successor). They are only
+  /// deleted, with @p context made current, when no other context shares
+  /// them.
+  /// @note Must be called before RenderState::release(@p context).
+  static void release(GLFWwindow* context) noexcept;
+
+  /// @brief Release every cached Program.
+  /// @note Programs still held elsewhere remain valid.
+  static void clear() noexcept;
+};
+
+}  // namespace nzl
@@ -0,0 +1,246 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      program_cache.t.cpp
+/// @brief     Unit tests for program_cache.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "program_cache.hpp"
+
+// C++ Standard Library
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// mxd Library
+#include "mxd.hpp"
+#include "shader.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace {  // anonymous namespace
+
+const std::string vertex_source =
+    "#version 330\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "void main() {\n"
+    "gl_Position = vec4(aPos, 1.0);\n}";
+
+const std::string red_source =
+    "#version 330\n"
+    "out vec4 FragColor;\n"
+    "void main(){\n"
+    "FragColor = vec4(1.0, 0.0, 0.0, 1.0);}";
+
+const std::string green_source =
+    "#version 330\n"
+    "out vec4 FragColor;\n"
+    "void main(){\n"
+    "FragColor = vec4(0.0, 1.0, 0.0, 1.0);}";
+
+}  // anonymous namespace
+
+TEST(ProgramCache, IdenticalSourcesShareAProgram) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  auto p1 =
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Vertex, vertex_source},
+                              {nzl::Shader::Stage::Fragment, red_source}});
+  EXPECT_EQ(nzl::ProgramCache::size(), 1u);
+
+  // The order in which the stages are listed does not matter.
+  auto p2 =
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Fragment, red_source},
+                              {nzl::Shader::Stage::Vertex, vertex_source}});
+  EXPECT_EQ(p1.id(), p2.id());
+  EXPECT_EQ(nzl::ProgramCache::size(), 1u);
+
+  auto p3 =
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Vertex, vertex_source},
+                              {nzl::Shader::Stage::Fragment, green_source}});
+  EXPECT_NE(p1.id(), p3.id());
+  EXPECT_EQ(nzl::ProgramCache::size(), 2u);
+
+  nzl::terminate();
+  EXPECT_EQ(nzl::ProgramCache::size(), 0u);
+}
+
+TEST(ProgramCache, Clear) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  auto p1 =
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Vertex, vertex_source},
+                              {nzl::Shader::Stage::Fragment, red_source}});
+  nzl::ProgramCache::clear();
+  EXPECT_EQ(nzl::ProgramCache::size(), 0u);
+
+  // Programs obtained before clearing remain valid.
+  EXPECT_NO_THROW(p1.use());
+
+  auto p2 =
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Vertex, vertex_source},
+                              {nzl::Shader::Stage::Fragment, red_source}});
+  EXPECT_NE(p1.id(), p2.id());
+
+  nzl::terminate();
+}
+
+TEST(ProgramCache, CompilationErrorsAreNotCached) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  EXPECT_THROW(
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Vertex, "void main() { x }"},
+                              {nzl::Shader::Stage::Fragment, red_source}}),
+      std::runtime_error);
+  EXPECT_EQ(nzl::ProgramCache::size(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(ProgramCache, BinaryDirectory) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  const auto directory =
+      std::filesystem::temp_directory_path() / "mxd-program-cache-test";
+  std::filesystem::remove_all(directory);
+
+  nzl::ProgramCache::set_binary_directory(directory.string());
+  EXPECT_EQ(nzl::ProgramCache::binary_directory(), directory.string());
+
+  const std::vector<nzl::ProgramCache::Source> sources{
+      {nzl::Shader::Stage::Vertex, vertex_source},
+      {nzl::Shader::Stage::Fragment, red_source}};
+
+  // The first request compiles (and stores a binary, if supported).
+  auto p1 = nzl::ProgramCache::get(sources);
+  EXPECT_NE(p1.id(), 0u);
+
+  // The second request (after dropping the in-memory copy) may be served from
+  // disk; either way it must produce a usable Program.
+  nzl::ProgramCache::clear();
+  auto p2 = nzl::ProgramCache::get(sources);
+  EXPECT_NO_THROW(p2.use());
+
+  // A corrupted binary falls back to a full compilation.
+  for (auto&& entry : std::filesystem::directory_iterator(directory)) {
+    std::ofstream fp(entry.path(), std::ios::out | std::ios::binary);
+    fp << "corrupted";
+  }
+  nzl::ProgramCache::clear();
+  auto p3 = nzl::ProgramCache::get(sources);
+  EXPECT_NO_THROW(p3.use());
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::ProgramCache::set_binary_directory("");
+  std::filesystem::remove_all(directory);
+
+  nzl::terminate();
+}
+
+TEST(ProgramCache, GetAll) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  auto red =
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Vertex, vertex_source},
+                              {nzl::Shader::Stage::Fragment, red_source}});
+
+  auto programs = nzl::ProgramCache::get_all(
+      {{{nzl::Shader::Stage::Vertex, vertex_source},
+        {nzl::Shader::Stage::Fragment, green_source}},
+       {{nzl::Shader::Stage::Fragment, red_source},
+        {nzl::Shader::Stage::Vertex, vertex_source}},
+       {{nzl::Shader::Stage::Vertex, vertex_source},
+        {nzl::Shader::Stage::Fragment, green_source}}});
+  ASSERT_EQ(programs.size(), 3u);
+
+  // Cached Programs are reused, and duplicates within a batch are merged.
+  EXPECT_EQ(programs[1].id(), red.id());
+  EXPECT_EQ(programs[0].id(), programs[2].id());
+  EXPECT_NE(programs[0].id(), red.id());
+  EXPECT_EQ(nzl::ProgramCache::size(), 2u);
+  EXPECT_NO_THROW(programs[0].use());
+
+  EXPECT_THROW(nzl::ProgramCache::get_all(
+                   {{{nzl::Shader::Stage::Vertex, "void main() { x }"}}}),
+               std::runtime_error);
+  EXPECT_EQ(nzl::ProgramCache::size(), 2u);
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(ProgramCache, ReleasedWithTheirShareGroup) {
+  nzl::initialize();
+  const std::vector<nzl::ProgramCache::Source> red_sources{
+      {nzl::Shader::Stage::Vertex, vertex_source},
+      {nzl::Shader::Stage::Fragment, red_source}};
+
+  auto first = std::make_unique<nzl::Window>(800, 600, "First Window");
+  first->hide();
+  first->make_current();
+  const auto red_id = nzl::ProgramCache::get(red_sources).id();
+
+  nzl::Window second(800, 600, "Second Window", *first);
+  second.hide();
+
+  // The Programs of the group survive its first window.
+  first.reset();
+  EXPECT_EQ(nzl::ProgramCache::size(), 1u);
+  second.make_current();
+  EXPECT_EQ(nzl::ProgramCache::get(red_sources).id(), red_id);
+  EXPECT_EQ(nzl::ProgramCache::size(), 1u);
+
+  // A window sharing nothing gets Programs of its own.
+  {
+    nzl::Window other(800, 600, "Other Window");
+    other.hide();
+    other.make_current();
+    EXPECT_NO_THROW(nzl::ProgramCache::get(red_sources).use());
+    EXPECT_EQ(nzl::ProgramCache::size(), 2u);
+  }
+
+  // The last window of a group takes its Programs along.
+  EXPECT_EQ(nzl::ProgramCache::size(), 1u);
+  second.make_current();
+  EXPECT_EQ(nzl::ProgramCache::get(red_sources).id(), red_id);
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(ProgramCache, RequiresCurrentContext) {
+  EXPECT_THROW(
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Vertex, vertex_source}}),
+      std::runtime_error);
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
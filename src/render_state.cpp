@@ -0,0 +1,203 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      render_state.cpp
+/// @brief     Implementation of render_state.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "render_state.hpp"
+
+// C++ Standard Library
+#include <atomic>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace {  // anonymous namespace
+
+std::mutex registry_mutex;
+
+/// Trackers live in map nodes, so references to them stay valid until their
+/// context is released.
+std::map<GLFWwindow*, nzl::RenderState> registry;
+
+/// First context of the share group of every context created sharing another.
+std::map<GLFWwindow*, GLFWwindow*> share_groups;
+
+/// Incremented whenever a tracker is discarded, so stale per-thread lookups
+/// are never used.
+std::atomic<unsigned long> generation{0};
+
+/// Last lookup performed by this thread, to keep current() off the mutex in
+/// the common case of a single long-lived context.
+struct Lookup {
+  GLFWwindow* context{nullptr};
+  nzl::RenderState* state{nullptr};
+  unsigned long generation{0};
+};
+
+thread_local Lookup last_lookup;
+
+/// @brief Implementation of RenderState::successor; requires registry_mutex.
+GLFWwindow* find_successor(GLFWwindow* context) noexcept {
+  if (auto it = share_groups.find(context); it != share_groups.end()) {
+    return it->second;
+  }
+  for (auto&& [member, group] : share_groups) {
+    if (group == context) {
+      return member;
+    }
+  }
+  return nullptr;
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+RenderState& RenderState::current() noexcept {
+  auto context = glfwGetCurrentContext();
+  const auto now = generation.load(std::memory_order_acquire);
+  if (last_lookup.state != nullptr && last_lookup.context == context &&
+      last_lookup.generation == now) {
+    return *last_lookup.state;
+  }
+
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto& state = registry[context];
+  last_lookup = Lookup{context, &state, now};
+  return state;
+}
+
+void RenderState::release(GLFWwindow* context) noexcept {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  registry.erase(context);
+
+  // Members of a group whose first context goes away join the successor,
+  // which now identifies the group; otherwise a later context created at the
+  // same address would join a group it shares nothing with.
+  const auto successor = find_successor(context);
+  share_groups.erase(context);
+  for (auto it = share_groups.begin(); it != share_groups.end();) {
+    if (it->second != context) {
+      ++it;
+    } else if (it->first == successor) {
+      it = share_groups.erase(it);
+    } else {
+      it->second = successor;
+      ++it;
+    }
+  }
+  generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void RenderState::clear() noexcept {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  registry.clear();
+  share_groups.clear();
+  generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void RenderState::share(GLFWwindow* context, GLFWwindow* shared_with) noexcept {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto it = share_groups.find(shared_with);
+  share_groups[context] = (it != share_groups.end()) ? it->second : shared_with;
+}
+
+GLFWwindow* RenderState::share_group(GLFWwindow* context) noexcept {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto it = share_groups.find(context);
+  return (it != share_groups.end()) ? it->second : context;
+}
+
+GLFWwindow* RenderState::successor(GLFWwindow* context) noexcept {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  return find_successor(context);
+}
+
+void RenderState::use_program(unsigned int id) noexcept {
+  if (m_program == id) {
+    ++m_elided_calls;
+    return;
+  }
+  glUseProgram(id);
+  m_program = id;
+}
+
+void RenderState::bind_vertex_array(unsigned int id) noexcept {
+  if (m_vertex_array == id) {
+    ++m_elided_calls;
+    return;
+  }
+  glBindVertexArray(id);
+  m_vertex_array = id;
+
+  // The element array binding is part of the vertex array state.
+  m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+}
+
+void RenderState::bind_buffer(unsigned int target, unsigned int id) noexcept {
+  if (auto it = m_buffers.find(target);
+      it != m_buffers.end() && it->second == id) {
+    ++m_elided_calls;
+    return;
+  }
+  glBindBuffer(target, id);
+  m_buffers[target] = id;
+}
+
+void RenderState::forget_program(unsigned int id) noexcept {
+  // The program may be deleted from a context other than the one it is bound
+  // in, so the binding becomes unknown rather than zero.
+  if (m_program == id) {
+    m_program = unknown;
+  }
+}
+
+void RenderState::forget_vertex_array(unsigned int id) noexcept {
+  if (m_vertex_array == id) {
+    m_vertex_array = unknown;
+    m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+  }
+  for (auto it = m_vertex_arrays.begin(); it != m_vertex_arrays.end();) {
+    it = (it->second.id == id) ? m_vertex_arrays.erase(it) : std::next(it);
+  }
+}
+
+unsigned int RenderState::find_vertex_array(
+    unsigned int key, unsigned int revision) const noexcept {
+  if (auto it = m_vertex_arrays.find(key);
+      it != m_vertex_arrays.end() && it->second.revision == revision) {
+    return it->second.id;
+  }
+  return 0;
+}
+
+void RenderState::store_vertex_array(unsigned int key, unsigned int revision,
+                                     unsigned int id) {
+  m_vertex_arrays[key] = VertexArrayName{id, revision};
+}
+
+void RenderState::forget_buffer(unsigned int id) noexcept {
+  for (auto it = m_buffers.begin(); it != m_buffers.end();) {
+    it = (it->second == id) ? m_buffers.erase(it) : std::next(it);
+  }
+}
+
+void RenderState::invalidate() noexcept {
+  m_program = unknown;
+  m_vertex_array = unknown;
+  m_buffers.clear();
+}
+
+std::size_t RenderState::elided_calls() const noexcept {
+  return m_elided_calls;
+}
+
+}  // namespace nzl
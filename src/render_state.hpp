@@ -0,0 +1,132 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      render_state.hpp
+/// @brief     Per-context cache of OpenGL bindings.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+
+// GLFW context handle (declared here to keep GLFW out of mxd headers).
+struct GLFWwindow;
+
+namespace nzl {
+
+/// @brief Cache of the program, vertex array, and buffers bound in one OpenGL
+/// context.
+///
+/// Every bind performed by mxd goes through the RenderState of the current
+/// context, which forwards it to OpenGL only when it would change the bound
+/// object. Consecutive @link Geometry Geometries@endlink sharing a program or
+/// a vertex array therefore issue no redundant calls, without knowing about
+/// each other.
+///
+/// The cache is only correct if every bind in the context goes through it.
+/// Code that binds objects directly must call invalidate() afterwards.
+///
+/// @note A RenderState must only be used from the thread in which its
+/// context is current.
+class RenderState {
+ public:
+  /// @brief Return the RenderState of the current context.
+  /// @note When there is no current context, returns a RenderState that is
+  /// never forwarded to a real context.
+  static RenderState& current() noexcept;
+
+  /// @brief Discard the RenderState associated with a context.
+  /// @param context Context about to be destroyed.
+  /// @note If @p context is the first context of a share group, the group is
+  /// handed over to successor(@p context).
+  static void release(GLFWwindow* context) noexcept;
+
+  /// @brief Discard every RenderState.
+  static void clear() noexcept;
+
+  /// @brief Record that a context was created sharing the objects of another.
+  /// @param context New context.
+  /// @param shared_with Context whose objects @p context shares.
+  static void share(GLFWwindow* context, GLFWwindow* shared_with) noexcept;
+
+  /// @brief Return the first context of the share group of @p context, which
+  /// identifies the group (@p context itself if it shares with none).
+  static GLFWwindow* share_group(GLFWwindow* context) noexcept;
+
+  /// @brief Return the context that identifies the share group of @p context
+  /// once @p context is released.
+  /// @return The group of @p context if it is not the first context of its
+  /// group, the surviving context that takes the group over if it is, or
+  /// nullptr if @p context shares with none.
+  static GLFWwindow* successor(GLFWwindow* context) noexcept;
+
+  /// @brief Make a program current (glUseProgram).
+  /// @param id Identifier of the program.
+  void use_program(unsigned int id) noexcept;
+
+  /// @brief Bind a vertex array (glBindVertexArray).
+  /// @param id Identifier of the vertex array.
+  void bind_vertex_array(unsigned int id) noexcept;
+
+  /// @brief Bind a buffer to a target (glBindBuffer).
+  /// @param target Binding target, e.g. GL_ARRAY_BUFFER.
+  /// @param id Identifier of the buffer.
+  void bind_buffer(unsigned int target, unsigned int id) noexcept;
+
+  /// @brief Record that a program is about to be deleted.
+  /// @param id Identifier of the program.
+  void forget_program(unsigned int id) noexcept;
+
+  /// @brief Record that a vertex array is about to be deleted.
+  /// @param id Identifier of the vertex array.
+  void forget_vertex_array(unsigned int id) noexcept;
+
+  /// @brief Return the vertex array of a VertexArray in this context.
+  /// @param key Key of the VertexArray (see VertexArray::key).
+  /// @param revision Current layout revision of the VertexArray.
+  /// @return Identifier of the vertex array, or 0 if it does not exist in this
+  /// context or was laid out at another revision.
+  unsigned int find_vertex_array(unsigned int key,
+                                 unsigned int revision) const noexcept;
+
+  /// @brief Record the vertex array of a VertexArray in this context.
+  /// @param key Key of the VertexArray (see VertexArray::key).
+  /// @param revision Layout revision the vertex array was laid out at.
+  /// @param id Identifier of the vertex array.
+  void store_vertex_array(unsigned int key, unsigned int revision,
+                          unsigned int id);
+
+  /// @brief Record that a buffer is about to be deleted.
+  /// @param id Identifier of the buffer.
+  void forget_buffer(unsigned int id) noexcept;
+
+  /// @brief Forget every cached binding, so the next bind of each kind is
+  /// always forwarded to OpenGL.
+  void invalidate() noexcept;
+
+  /// @brief Return the number of binds that were not forwarded to OpenGL
+  /// because the object was already bound.
+  std::size_t elided_calls() const noexcept;
+
+ private:
+  /// Value of a binding whose state is not known.
+  static constexpr unsigned int unknown = ~0u;
+
+  unsigned int m_program{unknown};
+  unsigned int m_vertex_array{unknown};
+  std::map<unsigned int, unsigned int> m_buffers;
+  std::size_t m_elided_calls{0};
+
+  /// Vertex array and layout revision of every VertexArray, by key.
+  struct VertexArrayName {
+    unsigned int id;
+    unsigned int revision;
+  };
+  std::unordered_map<unsigned int, VertexArrayName> m_vertex_arrays;
+};
+
+}  // namespace nzl
@@ -0,0 +1,170 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      render_state.t.cpp
+/// @brief     Unit tests for render_state.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "render_state.hpp"
+
+// C++ Standard Library
+#include <memory>
+#include <vector>
+
+// mxd Library
+#include "ellipse.hpp"
+#include "line.hpp"
+#include "mxd.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+TEST(RenderState, RedundantBindsAreElided) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  auto& state = nzl::RenderState::current();
+  EXPECT_EQ(&state, &nzl::RenderState::current());
+
+  unsigned int vao_id{0};
+  glGenVertexArrays(1, &vao_id);
+
+  state.bind_vertex_array(vao_id);
+  const auto elided = state.elided_calls();
+  state.bind_vertex_array(vao_id);
+  EXPECT_EQ(state.elided_calls(), elided + 1);
+
+  int bound{0};
+  glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &bound);
+  EXPECT_EQ(static_cast<unsigned int>(bound), vao_id);
+
+  state.bind_vertex_array(0);
+  EXPECT_EQ(state.elided_calls(), elided + 1);
+  glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &bound);
+  EXPECT_EQ(bound, 0);
+
+  state.forget_vertex_array(vao_id);
+  glDeleteVertexArrays(1, &vao_id);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(RenderState, InvalidateForwardsNextBind) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Line line(glm::vec3(1.0f, 0.0f, 0.0f));
+  auto id = line.get_program().id();
+
+  auto& state = nzl::RenderState::current();
+  state.use_program(id);
+
+  // Bypass the tracker, as foreign code would.
+  glUseProgram(0);
+  state.invalidate();
+
+  const auto elided = state.elided_calls();
+  state.use_program(id);
+  EXPECT_EQ(state.elided_calls(), elided);
+
+  int current{0};
+  glGetIntegerv(GL_CURRENT_PROGRAM, &current);
+  EXPECT_EQ(static_cast<unsigned int>(current), id);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(RenderState, GeometriesSharingProgramElideBinds) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  std::vector<glm::vec3> points{{-0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}};
+  nzl::Line a(glm::vec3(1.0f, 0.0f, 0.0f), points);
+  nzl::Line b(glm::vec3(0.0f, 1.0f, 0.0f), points);
+  nzl::Ellipse c(0.5f, 0.3f, 100, glm::vec3(0.0f, 0.0f, 1.0f));
+
+  auto& state = nzl::RenderState::current();
+  for (int i = 0; i < 3; i++) {
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    a.render(nzl::TimePoint());
+    const auto elided = state.elided_calls();
+    b.render(nzl::TimePoint());
+
+    // The second line shares the program of the first.
+    EXPECT_GT(state.elided_calls(), elided);
+
+    c.render(nzl::TimePoint());
+
+    win.swap_buffers();
+  }
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(RenderState, ShareGroupOutlivesItsFirstWindow) {
+  nzl::initialize();
+  auto first = std::make_unique<nzl::Window>(800, 600, "First Window");
+  first->hide();
+  first->make_current();
+  const auto first_context = glfwGetCurrentContext();
+
+  nzl::Window second(800, 600, "Second Window", *first);
+  second.hide();
+  second.make_current();
+  const auto second_context = glfwGetCurrentContext();
+  EXPECT_EQ(nzl::RenderState::share_group(second_context), first_context);
+  EXPECT_EQ(nzl::RenderState::successor(first_context), second_context);
+  EXPECT_EQ(nzl::RenderState::successor(second_context), first_context);
+
+  // The surviving window takes the group over.
+  first.reset();
+  EXPECT_EQ(nzl::RenderState::share_group(second_context), second_context);
+  EXPECT_EQ(nzl::RenderState::successor(second_context), nullptr);
+
+  nzl::Window third(800, 600, "Third Window", second);
+  third.hide();
+  third.make_current();
+  const auto third_context = glfwGetCurrentContext();
+  EXPECT_EQ(nzl::RenderState::share_group(third_context), second_context);
+
+  // A window sharing nothing, possibly at the address of the first, joins no
+  // group.
+  nzl::Window fourth(800, 600, "Fourth Window");
+  fourth.hide();
+  fourth.make_current();
+  const auto fourth_context = glfwGetCurrentContext();
+  EXPECT_EQ(nzl::RenderState::share_group(fourth_context), fourth_context);
+  EXPECT_EQ(nzl::RenderState::share_group(second_context), second_context);
+  EXPECT_EQ(nzl::RenderState::share_group(third_context), second_context);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
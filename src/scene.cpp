@@ -0,0 +1,117 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      scene.cpp
+/// @brief     Implementation of scene.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "scene.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+// mxd Library
+#include "geometry.hpp"
+#include "time_point.hpp"
+
+namespace nzl {
+
+struct Scene::SceneImp {
+  /// @brief One entry of the draw list.
+  struct Draw {
+    Geometry::DrawKey key;
+    Scene::Id id;
+    Geometry* geometry;
+  };
+
+  Scene::Id next_id{0};
+  std::map<Scene::Id, std::shared_ptr<Geometry>> members;
+
+  /// Draw list, kept in the order of the previous frame.
+  std::vector<Draw> draws;
+  bool draws_are_stale{false};
+
+  void rebuild_draws();
+  void sort_draws();
+};
+
+void Scene::SceneImp::rebuild_draws() {
+  draws.clear();
+  draws.reserve(members.size());
+  for (auto&& [id, geometry] : members) {
+    draws.push_back({Geometry::DrawKey{}, id, geometry.get()});
+  }
+  draws_are_stale = false;
+}
+
+void Scene::SceneImp::sort_draws() {
+  // Keys can change between frames (e.g. when a member is reloaded), so they
+  // are queried every time. The list usually comes out already sorted from
+  // the previous frame, in which case the sort is skipped.
+  for (auto&& draw : draws) {
+    draw.key = draw.geometry->draw_key();
+  }
+
+  auto by_key = [](const Draw& lhs, const Draw& rhs) {
+    if (lhs.key == rhs.key) {
+      return lhs.id < rhs.id;
+    }
+    return lhs.key < rhs.key;
+  };
+
+  if (!std::is_sorted(draws.begin(), draws.end(), by_key)) {
+    std::sort(draws.begin(), draws.end(), by_key);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//         The section below forwards API calls to the implementation
+// -----------------------------------------------------------------------------
+
+Scene::Scene() : m_pimpl{std::make_shared<Scene::SceneImp>()} {}
+
+Scene::Id Scene::add(std::shared_ptr<Geometry> geometry) {
+  if (geometry == nullptr) {
+    throw std::runtime_error("Cannot add a null Geometry to a Scene");
+  }
+  const auto id = m_pimpl->next_id++;
+  m_pimpl->members.emplace(id, std::move(geometry));
+  m_pimpl->draws_are_stale = true;
+  return id;
+}
+
+void Scene::remove(Id id) {
+  if (m_pimpl->members.erase(id) == 0) {
+    std::ostringstream oss;
+    oss << "Scene does not contain a member with id " << id;
+    throw std::runtime_error(oss.str());
+  }
+  m_pimpl->draws_are_stale = true;
+}
+
+bool Scene::contains(Id id) const noexcept {
+  return m_pimpl->members.count(id) > 0;
+}
+
+std::size_t Scene::size() const noexcept { return m_pimpl->members.size(); }
+
+void Scene::do_render(TimePoint t) {
+  if (m_pimpl->draws_are_stale) {
+    m_pimpl->rebuild_draws();
+  }
+
+  m_pimpl->sort_draws();
+
+  for (auto&& draw : m_pimpl->draws) {
+    draw.geometry->render(t);
+  }
+}
+
+}  // namespace nzl
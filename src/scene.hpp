@@ -0,0 +1,82 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      scene.hpp
+/// @brief     A collection of @link Geometry Geometries@endlink drawn together.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// mxd Library
+#include "geometry.hpp"
+#include "time_point.hpp"
+
+namespace nzl {
+
+/// @brief A collection of @link Geometry Geometries@endlink drawn in
+/// state-sorted order.
+///
+/// Every frame, the Scene orders its members by their Geometry::DrawKey and
+/// renders them in that order, so members sharing a program or a vertex array
+/// are drawn back to back and the RenderState elides the repeated binds. A
+/// scene mixing many lines and ellipses therefore switches programs once per
+/// type instead of once per object. Members with equal keys are drawn in the
+/// order in which they were added.
+///
+/// A Scene is itself a Geometry, so scenes can be nested.
+class Scene : public Geometry {
+ public:
+  /// @brief Identifier of a member within a Scene.
+  using Id = std::size_t;
+
+  /// @brief Creates an empty Scene.
+  Scene();
+
+  /// @brief Adds a copy of a Geometry to the Scene.
+  /// @param geometry Geometry to be added.
+  /// @return Identifier used to refer to the member afterwards.
+  /// @note Geometries share their state among copies, so the caller can keep
+  /// modifying @p geometry after adding it.
+  /// @note Affects all copies of this object.
+  template <typename T,
+            typename = std::enable_if_t<std::is_base_of_v<Geometry, T>>>
+  Id add(T geometry) {
+    return add(std::shared_ptr<Geometry>(
+        std::make_shared<T>(std::move(geometry))));
+  }
+
+  /// @brief Adds a Geometry to the Scene.
+  /// @param geometry Geometry to be added.
+  /// @return Identifier used to refer to the member afterwards.
+  /// @throws std::runtime_error if @p geometry is null.
+  /// @note Affects all copies of this object.
+  Id add(std::shared_ptr<Geometry> geometry);
+
+  /// @brief Removes a member from the Scene.
+  /// @param id Identifier returned by add().
+  /// @throws std::runtime_error if @p id is not in the Scene.
+  /// @note Affects all copies of this object.
+  void remove(Id id);
+
+  /// @brief Returns whether the Scene contains a member.
+  /// @param id Identifier returned by add().
+  bool contains(Id id) const noexcept;
+
+  /// @brief Returns the number of members in the Scene.
+  std::size_t size() const noexcept;
+
+ private:
+  struct SceneImp;
+  std::shared_ptr<SceneImp> m_pimpl;
+
+  void do_render(TimePoint t) override;
+};
+
+}  // namespace nzl
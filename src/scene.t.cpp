@@ -0,0 +1,152 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      scene.t.cpp
+/// @brief     Unit tests for scene.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "scene.hpp"
+
+// C++ Standard Library
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// mxd Library
+#include "ellipse.hpp"
+#include "geometry.hpp"
+#include "line.hpp"
+#include "mxd.hpp"
+#include "render_state.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+namespace {  // anonymous namespace
+
+/// @brief Geometry with a fixed draw key that records when it is rendered.
+class Probe : public nzl::Geometry {
+ public:
+  Probe(int name, DrawKey key, std::shared_ptr<std::vector<int>> log)
+      : m_name{name}, m_key{key}, m_log{std::move(log)} {}
+
+  void set_key(DrawKey key) noexcept { m_key = key; }
+
+ private:
+  int m_name;
+  DrawKey m_key;
+  std::shared_ptr<std::vector<int>> m_log;
+
+  void do_render(nzl::TimePoint t [[maybe_unused]]) override {
+    m_log->push_back(m_name);
+  }
+
+  DrawKey do_draw_key() const noexcept override { return m_key; }
+};
+
+}  // anonymous namespace
+
+TEST(Scene, DrawKeyOrdering) {
+  using Key = nzl::Geometry::DrawKey;
+  EXPECT_TRUE((Key{1, 5, false} < Key{2, 1, false}));
+  EXPECT_TRUE((Key{1, 1, false} < Key{1, 2, false}));
+  EXPECT_TRUE((Key{9, 9, false} < Key{1, 1, true}));
+  EXPECT_TRUE((Key{1, 2, true} == Key{1, 2, true}));
+  EXPECT_FALSE((Key{1, 2, true} < Key{1, 2, true}));
+}
+
+TEST(Scene, AddAndRemove) {
+  auto log = std::make_shared<std::vector<int>>();
+  nzl::Scene scene;
+  EXPECT_EQ(scene.size(), 0u);
+
+  auto a = scene.add(Probe(0, {}, log));
+  auto b = scene.add(Probe(1, {}, log));
+  EXPECT_NE(a, b);
+  EXPECT_EQ(scene.size(), 2u);
+  EXPECT_TRUE(scene.contains(a));
+
+  scene.remove(a);
+  EXPECT_FALSE(scene.contains(a));
+  EXPECT_EQ(scene.size(), 1u);
+
+  EXPECT_THROW(scene.remove(a), std::runtime_error);
+  EXPECT_THROW(scene.add(std::shared_ptr<nzl::Geometry>()),
+               std::runtime_error);
+
+  scene.render(nzl::TimePoint());
+  EXPECT_EQ(*log, std::vector<int>({1}));
+}
+
+TEST(Scene, RendersInDrawKeyOrder) {
+  auto log = std::make_shared<std::vector<int>>();
+  nzl::Scene scene;
+
+  scene.add(Probe(0, {2, 1, false}, log));
+  scene.add(Probe(1, {1, 1, true}, log));
+  scene.add(Probe(2, {1, 2, false}, log));
+  auto moving = std::make_shared<Probe>(3, nzl::Geometry::DrawKey{2, 1, false},
+                                        log);
+  scene.add(moving);
+  scene.add(Probe(4, {1, 1, false}, log));
+
+  // Equal keys keep the order in which they were added.
+  scene.render(nzl::TimePoint());
+  EXPECT_EQ(*log, std::vector<int>({4, 2, 0, 3, 1}));
+
+  // Keys are queried every frame.
+  log->clear();
+  moving->set_key({0, 0, false});
+  scene.render(nzl::TimePoint());
+  EXPECT_EQ(*log, std::vector<int>({3, 4, 2, 0, 1}));
+}
+
+TEST(Scene, OneProgramSwitchPerType) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  std::vector<glm::vec3> points{{-0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}};
+
+  // Interleave two types that use different programs.
+  nzl::Scene scene;
+  const int count = 50;
+  for (int k = 0; k < count; ++k) {
+    scene.add(nzl::Line(glm::vec3(1.0f, 0.0f, 0.0f), points));
+    scene.add(nzl::Ellipse(0.5f, 0.3f, 100, glm::vec3(0.0f, 0.0f, 1.0f),
+                           nzl::Ellipse::Mode::Procedural));
+  }
+  EXPECT_EQ(scene.size(), 2u * count);
+
+  auto& state = nzl::RenderState::current();
+  for (int i = 0; i < 3; i++) {
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    const auto elided = state.elided_calls();
+    scene.render(nzl::TimePoint());
+
+    // Only the first member of each type binds its program.
+    EXPECT_GE(state.elided_calls() - elided, 2u * count - 2u);
+
+    win.swap_buffers();
+  }
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
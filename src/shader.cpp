@@ -85,6 +85,7 @@ namespace nzl {
 
 struct Shader::IDContainer {
   const unsigned int m_id;
+  bool m_submitted{false};
   bool m_compiled{false};
 
   IDContainer(unsigned int id) noexcept : m_id{id} {}
@@ -104,12 +105,29 @@ const std::string& Shader::source() const noexcept { return m_source; }
 unsigned int Shader::id() const noexcept { return m_id_container->m_id; }
 
 void Shader::compile() {
+  submit();
+  check_compilation_errors(m_id_container->m_id);
+  m_id_container->m_compiled = true;
+}
+
+void Shader::submit() {
+  if (m_id_container->m_submitted) {
+    return;
+  }
   const auto source_ptr = m_source.data();
   const int source_size = m_source.size();
   glShaderSource(m_id_container->m_id, 1, &source_ptr, &source_size);
   glCompileShader(m_id_container->m_id);
-  check_compilation_errors(m_id_container->m_id);
-  m_id_container->m_compiled = true;
+  m_id_container->m_submitted = true;
+}
+
+bool Shader::is_ready() const noexcept {
+  if (!GLEW_KHR_parallel_shader_compile && !GLEW_ARB_parallel_shader_compile) {
+    return true;
+  }
+  int is_complete{GL_TRUE};
+  glGetShaderiv(m_id_container->m_id, GL_COMPLETION_STATUS_KHR, &is_complete);
+  return is_complete == GL_TRUE;
 }
 
 bool Shader::is_compiled() const noexcept { return m_id_container->m_compiled; }
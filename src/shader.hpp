@@ -43,8 +43,24 @@ class Shader {
 
   /// @brief Compile this Shader.
   /// @throws std::runtime_error on compilation failure.
+  /// @note Waits for a compilation started by submit(), or starts one.
   void compile();
 
+  /// @brief Hands the source of this Shader to the driver for compilation,
+  /// without waiting for the result.
+  /// @note Does nothing if the Shader was already submitted or compiled.
+  /// Errors are reported by compile().
+  ///
+  /// Querying the result of a compilation forces the driver to finish it, so
+  /// submitting every Shader before compiling any lets the driver overlap the
+  /// work (on several threads with KHR_parallel_shader_compile).
+  void submit();
+
+  /// @brief Returns whether the compilation started by submit() finished.
+  /// @note Never blocks. Without KHR_parallel_shader_compile the driver cannot
+  /// tell, and the result is always true.
+  bool is_ready() const noexcept;
+
   /// @brief Returns whether the Shader has been compiled.
   bool is_compiled() const noexcept;
 
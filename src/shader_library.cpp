@@ -0,0 +1,236 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      shader_library.cpp
+/// @brief     Implementation of shader_library.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "shader_library.hpp"
+
+// C++ Standard Library
+#include <cerrno>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+// Linux
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// mxd Library
+#include "mxd.hpp"
+#include "program_cache.hpp"
+#include "utilities.hpp"
+
+namespace {  // anonymous namespace
+
+/// @brief A shader embedded at build time.
+struct Embedded {
+  const char* name;
+  const char* source;
+};
+
+/// Generated from src/shaders by CMake/EmbedShaders.cmake.
+const Embedded embedded[] = {
+#include "embedded_shaders.inc"
+};
+
+/// @brief State of the library, guarded by its mutex.
+struct Library {
+  std::mutex mutex;
+
+  /// Current source of every shader, by name.
+  std::map<std::string, std::string, std::less<>> sources;
+
+  /// Watched directory, and its inotify descriptors (-1 if not watching).
+  std::string directory;
+  int fd{-1};
+  int wd{-1};
+
+  /// Shaders to pick up at the next reload, besides those inotify reports.
+  std::set<std::string> pending;
+
+  Library() {
+    for (auto&& shader : embedded) {
+      sources.emplace(shader.name, shader.source);
+    }
+  }
+};
+
+Library& library() {
+  static Library instance;
+  return instance;
+}
+
+/// @brief Stop watching. Requires the library mutex.
+void close_watch(Library& lib) noexcept {
+#ifdef __linux__
+  if (lib.fd >= 0) {
+    ::close(lib.fd);
+  }
+#endif
+  lib.fd = -1;
+  lib.wd = -1;
+  lib.directory.clear();
+  lib.pending.clear();
+}
+
+/// @brief Add to the pending set every shader inotify reports as written.
+/// Requires the library mutex.
+void drain_events(Library& lib) {
+#ifdef __linux__
+  alignas(inotify_event) char buffer[4096];
+  for (;;) {
+    const auto length = ::read(lib.fd, buffer, sizeof(buffer));
+    if (length <= 0) {
+      // EAGAIN: no more events (the descriptor is non-blocking).
+      return;
+    }
+    for (auto p = buffer; p < buffer + length;) {
+      const auto* event = reinterpret_cast<const inotify_event*>(p);
+      if (event->len > 0) {
+        std::string name(event->name);
+        if (lib.sources.count(name) > 0) {
+          lib.pending.insert(std::move(name));
+        }
+      }
+      p += sizeof(inotify_event) + event->len;
+    }
+  }
+#else
+  static_cast<void>(lib);
+#endif
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+std::string ShaderLibrary::get(std::string_view name) {
+  auto& lib = library();
+  std::lock_guard<std::mutex> lock(lib.mutex);
+  if (auto it = lib.sources.find(name); it != lib.sources.end()) {
+    return it->second;
+  }
+  std::ostringstream oss;
+  oss << "ShaderLibrary has no shader named \"" << name << "\"";
+  throw std::runtime_error(oss.str());
+}
+
+std::vector<std::string> ShaderLibrary::names() {
+  std::vector<std::string> result;
+  for (auto&& shader : embedded) {
+    result.emplace_back(shader.name);
+  }
+  return result;
+}
+
+void ShaderLibrary::watch(const std::string& directory) {
+#ifdef __linux__
+  auto& lib = library();
+  std::lock_guard<std::mutex> lock(lib.mutex);
+  close_watch(lib);
+
+  const int fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd < 0) {
+    throw std::system_error(errno, std::system_category(),
+                            "Cannot initialize inotify");
+  }
+
+  // Editors either rewrite a file or move a new one over it.
+  const int wd =
+      ::inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+  if (wd < 0) {
+    const auto error = errno;
+    ::close(fd);
+    std::ostringstream oss;
+    oss << "Cannot watch shader directory \"" << directory << "\"";
+    throw std::system_error(error, std::system_category(), oss.str());
+  }
+
+  lib.fd = fd;
+  lib.wd = wd;
+  lib.directory = directory;
+  for (auto&& [name, source] : lib.sources) {
+    lib.pending.insert(name);
+  }
+#else
+  std::ostringstream oss;
+  oss << "Cannot watch shader directory \"" << directory
+      << "\": ShaderLibrary::watch requires inotify";
+  throw std::runtime_error(oss.str());
+#endif
+}
+
+void ShaderLibrary::unwatch() noexcept {
+  auto& lib = library();
+  std::lock_guard<std::mutex> lock(lib.mutex);
+  close_watch(lib);
+}
+
+std::string ShaderLibrary::watched_directory() {
+  auto& lib = library();
+  std::lock_guard<std::mutex> lock(lib.mutex);
+  return lib.directory;
+}
+
+std::size_t ShaderLibrary::reload() {
+  nzl::requires_current_context();
+
+  auto& lib = library();
+  std::set<std::string> changed;
+  std::string directory;
+  {
+    std::lock_guard<std::mutex> lock(lib.mutex);
+    if (lib.fd < 0) {
+      return 0;
+    }
+    drain_events(lib);
+    changed.swap(lib.pending);
+    directory = lib.directory;
+  }
+
+  std::size_t count{0};
+  for (auto it = changed.begin(); it != changed.end(); ++it) {
+    std::string source;
+    try {
+      source = nzl::slurp(directory + "/" + *it);
+    } catch (const std::system_error&) {
+      // Deleted, or not there at all: keep the current source.
+      continue;
+    }
+
+    const auto previous = get(*it);
+    if (source == previous) {
+      continue;
+    }
+
+    // Relink without the lock, so other threads can keep looking up shaders.
+    try {
+      count += ProgramCache::relink(previous, source);
+    } catch (...) {
+      // Leave the shaders not processed yet for the next reload.
+      std::lock_guard<std::mutex> lock(lib.mutex);
+      lib.pending.insert(std::next(it), changed.end());
+      throw;
+    }
+
+    std::lock_guard<std::mutex> lock(lib.mutex);
+    lib.sources[*it] = std::move(source);
+  }
+  return count;
+}
+
+}  // namespace nzl
@@ -0,0 +1,68 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      shader_library.hpp
+/// @brief     Shader sources embedded into mxd, with optional hot-reload.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nzl {
+
+/// @brief Process-wide library of the shaders that ship with mxd.
+///
+/// The files in src/shaders are embedded into the library at build time, so
+/// looking up a shader does no file I/O and running mxd requires no shader
+/// files on disk.
+///
+/// For shader development, watch() makes the library follow a directory of
+/// shader files (typically src/shaders itself). Each call to reload() then
+/// picks up the files saved since the previous call, and relinks in place
+/// every cached Program that uses them (see ProgramCache::relink), so the
+/// running application draws with the edited code.
+class ShaderLibrary {
+ public:
+  /// @brief Return the source of a shader.
+  /// @param name File name of the shader within src/shaders (e.g.
+  /// "simple_shader.vert").
+  /// @throws std::runtime_error if there is no such shader.
+  static std::string get(std::string_view name);
+
+  /// @brief Return the names of every shader in the library.
+  static std::vector<std::string> names();
+
+  /// @brief Follow the shader files in @p directory.
+  /// @throws std::system_error if the directory cannot be watched.
+  /// @throws std::runtime_error on platforms without inotify (only Linux has
+  /// it).
+  /// @note The first reload() afterwards picks up every file in @p directory
+  /// that differs from the embedded copy. Files whose names are not in the
+  /// library are ignored.
+  static void watch(const std::string& directory);
+
+  /// @brief Stop following the watched directory.
+  /// @note Sources keep the contents of the last reload.
+  static void unwatch() noexcept;
+
+  /// @brief Return the watched directory (empty if none).
+  static std::string watched_directory();
+
+  /// @brief Pick up the shader files saved since the last call, and relink the
+  /// cached Programs that use them in the share group of the current context.
+  /// @return Number of Programs relinked.
+  /// @throws std::runtime_error if a changed shader fails to compile or link.
+  /// The library keeps its previous source for that shader, and picks it up
+  /// again when it is next saved.
+  /// @note Requires a current context. Does nothing unless watching; call it
+  /// once per frame (e.g. after polling events).
+  static std::size_t reload();
+};
+
+}  // namespace nzl
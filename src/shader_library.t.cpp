@@ -0,0 +1,120 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      shader_library.t.cpp
+/// @brief     Unit tests for shader_library.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "shader_library.hpp"
+
+// C++ Standard Library
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// mxd Library
+#include "mxd.hpp"
+#include "program_cache.hpp"
+#include "shader.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace {  // anonymous namespace
+
+void write_file(const std::filesystem::path& path, const std::string& text) {
+  std::ofstream fp(path, std::ios::out | std::ios::binary);
+  fp << text;
+}
+
+}  // anonymous namespace
+
+TEST(ShaderLibrary, EmbeddedShaders) {
+  // Embedded shaders need neither a context nor any file on disk.
+  auto names = nzl::ShaderLibrary::names();
+  EXPECT_NE(std::find(names.begin(), names.end(), "simple_shader.vert"),
+            names.end());
+  for (auto&& name : names) {
+    EXPECT_NE(nzl::ShaderLibrary::get(name).find("#version"),
+              std::string::npos);
+  }
+  EXPECT_THROW(nzl::ShaderLibrary::get("missing.vert"), std::runtime_error);
+  EXPECT_EQ(nzl::ShaderLibrary::watched_directory(), "");
+}
+
+TEST(ShaderLibrary, ReloadRelinksInPlace) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Invisible Window");
+  win.hide();
+  win.make_current();
+
+  // Nothing to do unless watching.
+  EXPECT_EQ(nzl::ShaderLibrary::reload(), 0u);
+
+  const auto directory =
+      std::filesystem::temp_directory_path() / "mxd-shader-library-test";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  for (auto&& name : nzl::ShaderLibrary::names()) {
+    write_file(directory / name, nzl::ShaderLibrary::get(name));
+  }
+
+  const auto original = nzl::ShaderLibrary::get("simple_shader.frag");
+  auto program = nzl::ProgramCache::get(
+      {{nzl::Shader::Stage::Vertex,
+        nzl::ShaderLibrary::get("simple_shader.vert")},
+       {nzl::Shader::Stage::Fragment, original}});
+  const auto id = program.id();
+  const auto revision = program.revision();
+
+  nzl::ShaderLibrary::watch(directory.string());
+  EXPECT_EQ(nzl::ShaderLibrary::watched_directory(), directory.string());
+
+  // Identical files relink nothing.
+  EXPECT_EQ(nzl::ShaderLibrary::reload(), 0u);
+
+  const auto edited = original + "\n// Edited.\n";
+  write_file(directory / "simple_shader.frag", edited);
+  EXPECT_EQ(nzl::ShaderLibrary::reload(), 1u);
+  EXPECT_EQ(nzl::ShaderLibrary::get("simple_shader.frag"), edited);
+  EXPECT_EQ(program.id(), id);
+  EXPECT_GT(program.revision(), revision);
+
+  // The cache hands out the relinked Program for the new sources.
+  auto same = nzl::ProgramCache::get(
+      {{nzl::Shader::Stage::Vertex,
+        nzl::ShaderLibrary::get("simple_shader.vert")},
+       {nzl::Shader::Stage::Fragment, edited}});
+  EXPECT_EQ(same.id(), id);
+
+  // A broken shader leaves the Program and the library as they were.
+  write_file(directory / "simple_shader.frag", "void main() { x }");
+  EXPECT_THROW(nzl::ShaderLibrary::reload(), std::runtime_error);
+  EXPECT_EQ(nzl::ShaderLibrary::get("simple_shader.frag"), edited);
+  EXPECT_NO_THROW(program.use());
+
+  write_file(directory / "simple_shader.frag", original);
+  EXPECT_EQ(nzl::ShaderLibrary::reload(), 1u);
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::ShaderLibrary::unwatch();
+  EXPECT_EQ(nzl::ShaderLibrary::watched_directory(), "");
+  std::filesystem::remove_all(directory);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
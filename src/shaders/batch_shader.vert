@@ -0,0 +1,42 @@
+#version 330 core
+
+layout(location = 0) in vec3 aPos;
+// One color per polyline, read per instance with indirect draws.
+layout(location = 1) in vec3 aColor;
+
+// Otherwise the color is that of the polyline whose range holds the vertex.
+// Texel k holds the first vertex of the k-th drawn polyline, in increasing
+// order, followed by the bits of its color (see nzl::LineBatch).
+uniform bool is_ranged = false;
+uniform usamplerBuffer ranges;
+
+// Frame constants shared by every program (see nzl::FrameUniforms).
+layout(std140) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 view_projection;
+  vec2 viewport;
+  float time_high;
+  float time_low;
+} frame;
+
+out vec3 vertexColor;
+
+vec3 ranged_color() {
+  int low = 0;
+  int high = textureSize(ranges) - 1;
+  while (low < high) {
+    int middle = (low + high + 1) / 2;
+    if (int(texelFetch(ranges, middle).x) <= gl_VertexID) {
+      low = middle;
+    } else {
+      high = middle - 1;
+    }
+  }
+  return uintBitsToFloat(texelFetch(ranges, low).yzw);
+}
+
+void main() {
+  gl_Position = frame.view_projection * vec4(aPos, 1.0);
+  vertexColor = is_ranged ? ranged_color() : aColor;
+}
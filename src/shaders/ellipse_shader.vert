@@ -0,0 +1,33 @@
+#version 330 core
+
+// Ellipse synthesized from gl_VertexID: no vertex buffer is needed, and every
+// parameter (including the number of points) can change freely between draws.
+uniform vec2 radii;
+uniform vec2 center;
+uniform float rotation;
+uniform int number_of_points;
+
+// Frame constants shared by every program (see nzl::FrameUniforms).
+layout(std140) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 view_projection;
+  vec2 viewport;
+  float time_high;
+  float time_low;
+} frame;
+
+// Opacity, read by the wide line geometry shader.
+out float v_alpha;
+
+const float two_pi = 6.28318530717958647692;
+
+void main() {
+  float angle = two_pi * float(gl_VertexID) / float(number_of_points);
+  vec2 p = radii * vec2(cos(angle), sin(angle));
+  float c = cos(rotation);
+  float s = sin(rotation);
+  p = center + vec2(c * p.x - s * p.y, s * p.x + c * p.y);
+  gl_Position = frame.view_projection * vec4(p, 0.0, 1.0);
+  v_alpha = 1.0;
+}
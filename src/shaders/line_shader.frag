@@ -0,0 +1,9 @@
+#version 330 core
+
+in float v_alpha;
+out vec4 FragColor;
+uniform vec3 color;
+
+void main() {
+  FragColor = vec4(color, v_alpha);
+}
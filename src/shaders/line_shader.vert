@@ -0,0 +1,62 @@
+#version 330 core
+
+layout(location = 0) in vec3 aPos;
+
+// Epoch of the vertex, in seconds past the first point of the line.
+layout(location = 1) in float epoch;
+
+// Remainder of a double-precision position after aPos (zero otherwise).
+layout(location = 2) in vec3 aPosLow;
+
+// Render time, in the same units as the epochs.
+uniform float time = 0.0;
+
+// Length of the fading trail; zero disables fading.
+uniform float trail_length = 0.0;
+
+// Eye position, split like the vertices into high and low parts.
+uniform vec3 eye_high = vec3(0.0);
+uniform vec3 eye_low = vec3(0.0);
+
+// Eye-relative coordinates to clip space, used instead of the view and
+// projection of the frame by double-precision lines.
+uniform mat4 transform = mat4(1.0);
+uniform bool is_relative_to_eye = false;
+
+// Compact encodings: aPos is relative to the box of its chunk of 256
+// vertices, whose origin and scale are the texels 2k and 2k + 1.
+const int chunk_size = 256;
+uniform bool is_quantized = false;
+uniform samplerBuffer chunk_boxes;
+
+// Frame constants shared by every program (see nzl::FrameUniforms).
+layout(std140) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 view_projection;
+  vec2 viewport;
+  float time_high;
+  float time_low;
+} frame;
+
+out float v_alpha;
+
+void main() {
+  vec3 position = aPos;
+  if (is_quantized) {
+    int chunk = gl_VertexID / chunk_size;
+    position = texelFetch(chunk_boxes, 2 * chunk).xyz +
+               texelFetch(chunk_boxes, 2 * chunk + 1).xyz * aPos;
+  }
+
+  // Near the eye the high parts are close, so their difference is exact and
+  // only then are the small low parts added.
+  vec3 high = position - eye_high;
+  vec3 low = aPosLow - eye_low;
+  mat4 to_clip = is_relative_to_eye ? transform : frame.view_projection;
+  gl_Position = to_clip * vec4(high + low, 1.0);
+  v_alpha = 1.0;
+  if (trail_length > 0.0) {
+    v_alpha = clamp(1.0 - (time - epoch) / trail_length, 0.0, 1.0);
+  }
+}
@@ -0,0 +1,46 @@
+#version 330 core
+
+// One instance per orbit: (a, e) and (i, w, W), as laid out in
+// nzl::OrbitSet::Elements.
+layout(location = 0) in vec2 shape;
+layout(location = 1) in vec3 orientation;
+
+uniform int number_of_points;
+uniform mat4 transform;
+
+// Frame constants shared by every program (see nzl::FrameUniforms).
+layout(std140) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 view_projection;
+  vec2 viewport;
+  float time_high;
+  float time_low;
+} frame;
+
+const float two_pi = 6.28318530717958647692;
+
+void main() {
+  float a = shape.x;
+  float e = shape.y;
+
+  // Sampling uniformly in eccentric anomaly places more points near periapsis,
+  // where the curvature is largest.
+  float E = two_pi * float(gl_VertexID) / float(number_of_points);
+  float x = a * (cos(E) - e);
+  float y = a * sqrt(1.0 - e * e) * sin(E);
+
+  // Rotate from the perifocal frame to the inertial frame: R3(-W) R1(-i) R3(-w).
+  float ci = cos(orientation.x);
+  float si = sin(orientation.x);
+  float cw = cos(orientation.y);
+  float sw = sin(orientation.y);
+  float cW = cos(orientation.z);
+  float sW = sin(orientation.z);
+
+  vec3 p = vec3((cW * cw - sW * sw * ci) * x + (-cW * sw - sW * cw * ci) * y,
+                (sW * cw + cW * sw * ci) * x + (-sW * sw + cW * cw * ci) * y,
+                (sw * si) * x + (cw * si) * y);
+
+  gl_Position = frame.view_projection * transform * vec4(p, 1.0);
+}
@@ -2,6 +2,20 @@
 
 layout(location = 0) in vec3 aPos;
 
+// Frame constants shared by every program (see nzl::FrameUniforms).
+layout(std140) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 view_projection;
+  vec2 viewport;
+  float time_high;
+  float time_low;
+} frame;
+
+// Opacity, read by the wide line geometry shader.
+out float v_alpha;
+
 void main() {
-  gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);
+  gl_Position = frame.view_projection * vec4(aPos, 1.0);
+  v_alpha = 1.0;
 }
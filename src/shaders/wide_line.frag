@@ -0,0 +1,9 @@
+#version 330 core
+
+in float g_alpha;
+out vec4 FragColor;
+uniform vec3 color;
+
+void main() {
+  FragColor = vec4(color, g_alpha);
+}
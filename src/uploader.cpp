@@ -0,0 +1,188 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      uploader.cpp
+/// @brief     Implementation of uploader.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "uploader.hpp"
+
+// C++ Standard Library
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// mxd Library
+#include "program_cache.hpp"
+#include "window.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace nzl {
+
+struct Uploader::Ticket::TicketImp {
+  std::mutex mutex;
+  std::condition_variable finished;
+  bool is_finished{false};
+  bool is_signaled{false};
+  GLsync fence{nullptr};
+  std::exception_ptr error;
+
+  ~TicketImp() noexcept {
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+    }
+  }
+
+  /// @brief Wait up to @p timeout nanoseconds for the fence.
+  /// @note Requires the mutex and a finished task.
+  bool check_fence(GLuint64 timeout) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    if (!is_signaled) {
+      const auto status = glClientWaitSync(fence, 0, timeout);
+      if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+        glDeleteSync(fence);
+        fence = nullptr;
+        is_signaled = true;
+      }
+    }
+    return is_signaled;
+  }
+};
+
+bool Uploader::Ticket::is_ready() const {
+  if (!m_pimpl) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(m_pimpl->mutex);
+  return m_pimpl->is_finished && m_pimpl->check_fence(0);
+}
+
+void Uploader::Ticket::wait() const {
+  if (!m_pimpl) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(m_pimpl->mutex);
+  m_pimpl->finished.wait(lock, [this] { return m_pimpl->is_finished; });
+  while (!m_pimpl->check_fence(1000000)) {
+  }
+}
+
+struct Uploader::UploaderImp {
+  /// @brief A queued task and its ticket.
+  struct Job {
+    Task task;
+    std::shared_ptr<Ticket::TicketImp> ticket;
+  };
+
+  nzl::Window window;
+  mutable std::mutex mutex;
+  std::condition_variable queued;
+  std::deque<Job> jobs;
+  std::size_t running{0};
+  bool is_stopping{false};
+  std::thread worker;
+
+  UploaderImp(const Window& shared) : window{1, 1, "mxd uploader", shared} {
+    window.hide();
+    worker = std::thread([this] { run(); });
+  }
+
+  ~UploaderImp() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      is_stopping = true;
+    }
+    queued.notify_one();
+    worker.join();
+  }
+
+  /// @brief Run queued jobs until stopped, then the remaining ones.
+  void run() {
+    std::exception_ptr setup_error;
+    try {
+      window.make_current();
+    } catch (...) {
+      setup_error = std::current_exception();
+    }
+
+    while (true) {
+      Job job;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        queued.wait(lock, [this] { return is_stopping || !jobs.empty(); });
+        if (jobs.empty()) {
+          break;
+        }
+        job = std::move(jobs.front());
+        jobs.pop_front();
+        ++running;
+      }
+
+      std::exception_ptr error = setup_error;
+      GLsync fence{nullptr};
+      if (!error) {
+        try {
+          job.task();
+        } catch (...) {
+          error = std::current_exception();
+        }
+
+        // The fence must reach the GPU for other contexts to see it signal.
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+      }
+
+      // Release the task (and whatever it holds) in the worker context.
+      job.task = nullptr;
+      {
+        std::lock_guard<std::mutex> lock(job.ticket->mutex);
+        job.ticket->fence = fence;
+        job.ticket->error = error;
+        job.ticket->is_finished = true;
+      }
+      job.ticket->finished.notify_all();
+
+      std::lock_guard<std::mutex> lock(mutex);
+      --running;
+    }
+
+    glfwMakeContextCurrent(nullptr);
+  }
+};
+
+Uploader::Uploader(const Window& window)
+    : m_pimpl{std::make_shared<UploaderImp>(window)} {}
+
+Uploader::Ticket Uploader::submit(Task task) {
+  Ticket ticket;
+  ticket.m_pimpl = std::make_shared<Ticket::TicketImp>();
+  {
+    std::lock_guard<std::mutex> lock(m_pimpl->mutex);
+    m_pimpl->jobs.push_back({std::move(task), ticket.m_pimpl});
+  }
+  m_pimpl->queued.notify_one();
+  return ticket;
+}
+
+Uploader::Ticket Uploader::compile(std::vector<ProgramCache::Source> sources) {
+  return submit([sources = std::move(sources)] { ProgramCache::get(sources); });
+}
+
+std::size_t Uploader::pending() const noexcept {
+  std::lock_guard<std::mutex> lock(m_pimpl->mutex);
+  return m_pimpl->jobs.size() + m_pimpl->running;
+}
+
+}  // namespace nzl
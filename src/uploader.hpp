@@ -0,0 +1,86 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      uploader.hpp
+/// @brief     Background uploads and compiles on a shared context.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// mxd Library
+#include "program_cache.hpp"
+#include "window.hpp"
+
+namespace nzl {
+
+/// @brief Worker thread that owns an OpenGL context shared with a Window.
+///
+/// Tasks submitted to an Uploader run in order on its worker thread, with a
+/// hidden context of the Window's share group current: buffers they fill and
+/// programs they link are visible to every context of the group. After each
+/// task the worker inserts a fence (glFenceSync) and flushes; the Ticket of
+/// the task reports it ready once that fence has signaled, so the render
+/// thread only ever adopts objects the GPU has finished writing, and never
+/// waits for them.
+///
+/// @note Create and destroy Uploaders on the main thread, as GLFW requires
+/// for windows.
+class Uploader {
+ public:
+  /// @brief Completion handle of a submitted task.
+  /// @note A default-constructed Ticket is always ready.
+  class Ticket {
+   public:
+    /// @brief Return whether the task ran and the GPU completed its commands.
+    /// @throws Any exception thrown by the task.
+    /// @note Never blocks. Requires a current context of the share group.
+    bool is_ready() const;
+
+    /// @brief Block until is_ready() would return true.
+    /// @throws Any exception thrown by the task.
+    /// @note Requires a current context of the share group.
+    void wait() const;
+
+   private:
+    friend class Uploader;
+    struct TicketImp;
+    std::shared_ptr<TicketImp> m_pimpl;
+  };
+
+  /// @brief Task run on the worker thread.
+  using Task = std::function<void()>;
+
+  /// @brief Start an Uploader sharing the objects of @p window.
+  /// @param window Window whose share group receives the uploads.
+  /// @throws std::runtime_error if the worker context cannot be created.
+  explicit Uploader(const Window& window);
+
+  /// @brief Queue a task.
+  /// @param task Task to run on the worker thread. OpenGL state it leaves
+  /// bound is private to the worker context.
+  Ticket submit(Task task);
+
+  /// @brief Queue the compilation of a program into the ProgramCache.
+  /// @param sources Source code for every stage of the Program.
+  ///
+  /// Once the ticket is ready, ProgramCache::get with the same sources
+  /// returns the compiled Program in any context of the share group without
+  /// compiling.
+  Ticket compile(std::vector<ProgramCache::Source> sources);
+
+  /// @brief Return the number of tasks that have not finished running.
+  std::size_t pending() const noexcept;
+
+ private:
+  struct UploaderImp;
+  std::shared_ptr<UploaderImp> m_pimpl;
+};
+
+}  // namespace nzl
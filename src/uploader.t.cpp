@@ -0,0 +1,151 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      uploader.t.cpp
+/// @brief     Unit tests for uploader.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "uploader.hpp"
+
+// C++ Standard Library
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// mxd Library
+#include "mxd.hpp"
+#include "program_cache.hpp"
+#include "shader.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace {  // anonymous namespace
+
+const std::string vertex_source =
+    "#version 330\n"
+    "layout (location = 0) in vec3 aPos;\n"
+    "void main() {\n"
+    "gl_Position = vec4(aPos, 1.0);\n}";
+
+const std::string fragment_source =
+    "#version 330\n"
+    "out vec4 FragColor;\n"
+    "void main(){\n"
+    "FragColor = vec4(0.0, 0.0, 1.0, 1.0);}";
+
+}  // anonymous namespace
+
+TEST(Uploader, TasksRunInOrder) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Uploader uploader(win);
+  std::vector<int> order;
+  std::vector<nzl::Uploader::Ticket> tickets;
+  for (int k = 0; k < 10; ++k) {
+    tickets.push_back(uploader.submit([&order, k] { order.push_back(k); }));
+  }
+  tickets.back().wait();
+  EXPECT_TRUE(tickets.back().is_ready());
+  EXPECT_EQ(order.size(), 10u);
+  for (int k = 0; k < 10; ++k) {
+    EXPECT_EQ(order[k], k);
+  }
+
+  // Default tickets are always ready.
+  EXPECT_TRUE(nzl::Uploader::Ticket().is_ready());
+
+  nzl::terminate();
+}
+
+TEST(Uploader, BuffersAreShared) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Uploader uploader(win);
+  unsigned int id{0};
+  const std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f};
+  auto ticket = uploader.submit([&id, &data] {
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(float), data.data(),
+                 GL_STATIC_DRAW);
+  });
+  ticket.wait();
+  EXPECT_EQ(uploader.pending(), 0u);
+
+  // The buffer filled on the worker is readable in the render context.
+  std::vector<float> copy(data.size());
+  glBindBuffer(GL_COPY_READ_BUFFER, id);
+  glGetBufferSubData(GL_COPY_READ_BUFFER, 0, copy.size() * sizeof(float),
+                     copy.data());
+  EXPECT_EQ(copy, data);
+  glDeleteBuffers(1, &id);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(Uploader, CompileWarmsTheProgramCache) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Uploader uploader(win);
+  const auto size = nzl::ProgramCache::size();
+  uploader
+      .compile({{nzl::Shader::Stage::Vertex, vertex_source},
+                {nzl::Shader::Stage::Fragment, fragment_source}})
+      .wait();
+  EXPECT_EQ(nzl::ProgramCache::size(), size + 1);
+
+  auto program =
+      nzl::ProgramCache::get({{nzl::Shader::Stage::Vertex, vertex_source},
+                              {nzl::Shader::Stage::Fragment, fragment_source}});
+  EXPECT_EQ(nzl::ProgramCache::size(), size + 1);
+  EXPECT_NO_THROW(program.use());
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(Uploader, ExceptionsReachTheTicket) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  nzl::Uploader uploader(win);
+  auto ticket =
+      uploader.submit([] { throw std::runtime_error("Failed upload"); });
+  EXPECT_THROW(ticket.wait(), std::runtime_error);
+  EXPECT_THROW(ticket.is_ready(), std::runtime_error);
+
+  // The worker survives.
+  std::atomic<bool> ran{false};
+  uploader.submit([&ran] { ran = true; }).wait();
+  EXPECT_TRUE(ran);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      vertex_array.cpp
+/// @brief     Implementation of vertex_array.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "vertex_array.hpp"
+
+// C++ Standard Library
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+// mxd Library
+#include "render_state.hpp"
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+namespace {  // anonymous namespace
+
+std::mutex registry_mutex;
+
+/// Vertex arrays whose VertexArray was destroyed while another context was
+/// current, waiting for their own context to be current again.
+std::map<GLFWwindow*, std::vector<unsigned int>> orphans;
+
+/// Whether any context has orphans, so binds elsewhere can skip the lock.
+std::atomic<bool> has_orphans{false};
+
+/// Source of VertexArray keys, which are never reused.
+std::atomic<unsigned int> next_key{1};
+
+/// @brief Delete the orphans of the current @p context.
+/// @note Requires registry_mutex.
+void delete_orphans(GLFWwindow* context) noexcept {
+  auto it = orphans.find(context);
+  if (it == orphans.end()) {
+    return;
+  }
+  auto& state = nzl::RenderState::current();
+  for (auto id : it->second) {
+    state.forget_vertex_array(id);
+  }
+  glDeleteVertexArrays(it->second.size(), it->second.data());
+  orphans.erase(it);
+  has_orphans.store(!orphans.empty(), std::memory_order_release);
+}
+
+}  // anonymous namespace
+
+namespace nzl {
+
+struct VertexArray::VertexArrayImp {
+  Layout layout;
+  const unsigned int key{next_key.fetch_add(1, std::memory_order_relaxed)};
+
+  /// Incremented by update(); contexts compare it with the revision at which
+  /// they ran the layout.
+  std::atomic<unsigned int> revision{0};
+
+  /// Vertex array of every context, guarded by registry_mutex.
+  std::map<GLFWwindow*, unsigned int> ids;
+
+  VertexArrayImp(Layout layout) : layout{std::move(layout)} {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    live().insert(this);
+  }
+
+  ~VertexArrayImp() noexcept {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    live().erase(this);
+
+    const auto context = glfwGetCurrentContext();
+    for (auto&& [owner, id] : ids) {
+      if (owner == context) {
+        RenderState::current().forget_vertex_array(id);
+        glDeleteVertexArrays(1, &id);
+      } else {
+        orphans[owner].push_back(id);
+        has_orphans.store(true, std::memory_order_release);
+      }
+    }
+  }
+
+  /// @brief Create or lay out the vertex array of the current context.
+  /// @param state RenderState of the current context.
+  /// @param current_revision Revision to lay the vertex array out at.
+  unsigned int prepare(RenderState& state, unsigned int current_revision) {
+    const auto context = glfwGetCurrentContext();
+
+    std::unique_lock<std::mutex> lock(registry_mutex);
+    delete_orphans(context);
+    auto& id = ids[context];
+    if (id == 0) {
+      glGenVertexArrays(1, &id);
+    } else if (state.find_vertex_array(key, current_revision) == id) {
+      return id;
+    }
+    const auto prepared = id;
+
+    // The layout binds buffers through the RenderState, and may bind other
+    // vertex arrays; it must run without the lock.
+    lock.unlock();
+    state.bind_vertex_array(prepared);
+    layout();
+    state.store_vertex_array(key, current_revision, prepared);
+    return prepared;
+  }
+
+  /// Every VertexArrayImp in existence, so that releasing a context reaches
+  /// all of them.
+  static std::set<VertexArrayImp*>& live() {
+    static std::set<VertexArrayImp*> imps;
+    return imps;
+  }
+};
+
+VertexArray::VertexArray(Layout layout)
+    : m_pimpl{std::make_shared<VertexArrayImp>(std::move(layout))} {}
+
+void VertexArray::bind() const {
+  RenderState::current().bind_vertex_array(id());
+}
+
+unsigned int VertexArray::id() const {
+  auto& state = RenderState::current();
+  const auto revision = m_pimpl->revision.load(std::memory_order_acquire);
+  if (!has_orphans.load(std::memory_order_acquire)) {
+    if (const auto id = state.find_vertex_array(m_pimpl->key, revision)) {
+      return id;
+    }
+  }
+  return m_pimpl->prepare(state, revision);
+}
+
+unsigned int VertexArray::key() const noexcept { return m_pimpl->key; }
+
+void VertexArray::update() noexcept {
+  m_pimpl->revision.fetch_add(1, std::memory_order_acq_rel);
+}
+
+std::size_t VertexArray::contexts() const noexcept {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  return m_pimpl->ids.size();
+}
+
+void VertexArray::release(GLFWwindow* context) noexcept {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  for (auto imp : VertexArrayImp::live()) {
+    imp->ids.erase(context);
+  }
+  orphans.erase(context);
+  has_orphans.store(!orphans.empty(), std::memory_order_release);
+}
+
+void VertexArray::clear() noexcept {
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  for (auto imp : VertexArrayImp::live()) {
+    imp->ids.clear();
+  }
+  orphans.clear();
+  has_orphans.store(false, std::memory_order_release);
+}
+
+}  // namespace nzl
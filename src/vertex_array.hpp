@@ -0,0 +1,79 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      vertex_array.hpp
+/// @brief     Vertex array object valid in every context of a share group.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+#pragma once
+
+// C++ Standard Library
+#include <functional>
+#include <memory>
+
+// GLFW context handle (declared here to keep GLFW out of mxd headers).
+struct GLFWwindow;
+
+namespace nzl {
+
+/// @brief Vertex array object, created on demand in every context in which it
+/// is bound.
+///
+/// Buffers and programs are shared by all the contexts of a share group, but
+/// vertex arrays are not. A VertexArray therefore keeps one OpenGL vertex
+/// array per context, and describes the vertex layout with a function rather
+/// than with state: the first bind in a context creates the vertex array and
+/// runs the layout with it bound, so a Geometry whose buffers were uploaded
+/// once can be drawn in every window of the group.
+///
+/// The vertex array of the current context is found in its RenderState, so a
+/// bind takes no lock unless it creates or lays out a vertex array.
+///
+/// @note Vertex arrays of other contexts are deleted the next time the
+/// VertexArray of any object is bound in them, or with their context.
+class VertexArray {
+ public:
+  /// @brief Function that enables and points the vertex attributes (and binds
+  /// the element buffer) of the bound vertex array.
+  using Layout = std::function<void()>;
+
+  /// @brief Create a VertexArray.
+  /// @param layout Layout of the vertex array.
+  /// @note No OpenGL object is created until the first bind.
+  explicit VertexArray(Layout layout);
+
+  /// @brief Bind the vertex array of the current context, creating it if
+  /// needed.
+  void bind() const;
+
+  /// @brief Return the identifier of the vertex array in the current context,
+  /// creating it if needed.
+  unsigned int id() const;
+
+  /// @brief Return a number that identifies this VertexArray (and its copies)
+  /// in every context, unlike id(), without creating anything.
+  unsigned int key() const noexcept;
+
+  /// @brief Record that the layout changed, so every context runs it again
+  /// on its next bind.
+  /// @note Affects all copies of this object.
+  void update() noexcept;
+
+  /// @brief Return the number of contexts in which the vertex array exists.
+  std::size_t contexts() const noexcept;
+
+  /// @brief Discard the vertex arrays of a context.
+  /// @param context Context about to be destroyed (which deletes them).
+  /// @note The RenderState of @p context must be released as well.
+  static void release(GLFWwindow* context) noexcept;
+
+  /// @brief Discard the vertex arrays of every context.
+  static void clear() noexcept;
+
+ private:
+  struct VertexArrayImp;
+  std::shared_ptr<VertexArrayImp> m_pimpl;
+};
+
+}  // namespace nzl
@@ -0,0 +1,148 @@
+// -*- coding:utf-8; mode:c++; mode:auto-fill; fill-column:80; -*-
+
+/// @file      vertex_array.t.cpp
+/// @brief     Unit tests for vertex_array.hpp.
+/// @author    J. Arrieta <Juan.Arrieta@nablazerolabs.com>
+/// @date      October 18, 2026
+/// @copyright (C) 2026 Nabla Zero Labs
+
+// Related mxd header
+#include "vertex_array.hpp"
+
+// C++ Standard Library
+#include <vector>
+
+// mxd Library
+#include "line.hpp"
+#include "mxd.hpp"
+#include "time_point.hpp"
+#include "window.hpp"
+
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Third party libraries
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+
+TEST(VertexArray, LayoutRunsOncePerContext) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  int layouts{0};
+  nzl::VertexArray vertex_array([&layouts] { ++layouts; });
+  EXPECT_EQ(vertex_array.contexts(), 0u);
+  EXPECT_EQ(layouts, 0);
+
+  vertex_array.bind();
+  vertex_array.bind();
+  EXPECT_EQ(vertex_array.contexts(), 1u);
+  EXPECT_EQ(layouts, 1);
+
+  int bound{0};
+  glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &bound);
+  EXPECT_NE(vertex_array.id(), 0u);
+  EXPECT_EQ(static_cast<unsigned int>(bound), vertex_array.id());
+
+  // A changed layout is applied on the next bind.
+  vertex_array.update();
+  EXPECT_EQ(layouts, 1);
+  vertex_array.bind();
+  EXPECT_EQ(layouts, 2);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(VertexArray, KeysHaveNoSideEffects) {
+  nzl::initialize();
+  nzl::Window win(800, 600, "Test Window");
+  win.hide();
+  win.make_current();
+
+  int layouts{0};
+  nzl::VertexArray vertex_array([&layouts] { ++layouts; });
+  nzl::VertexArray other([] {});
+  const auto copy = vertex_array;
+
+  // Keys identify the object and its copies, and create nothing.
+  EXPECT_EQ(copy.key(), vertex_array.key());
+  EXPECT_NE(other.key(), vertex_array.key());
+  EXPECT_EQ(vertex_array.contexts(), 0u);
+
+  vertex_array.bind();
+  const auto key = vertex_array.key();
+  const auto id = vertex_array.id();
+  EXPECT_EQ(vertex_array.key(), key);
+
+  // Later binds find the vertex array without running the layout again.
+  other.bind();
+  vertex_array.bind();
+  EXPECT_EQ(vertex_array.id(), id);
+  EXPECT_EQ(layouts, 1);
+
+  // So do geometries computing their draw key.
+  std::vector<glm::vec3> points{{-0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}};
+  nzl::Line line(glm::vec3(1.0f, 0.0f, 0.0f), points);
+  const auto draw_key = line.draw_key();
+  line.render(nzl::TimePoint());
+  EXPECT_TRUE(line.draw_key() == draw_key);
+
+  EXPECT_EQ(glGetError(), 0u);
+
+  nzl::terminate();
+}
+
+TEST(VertexArray, SharedContexts) {
+  nzl::initialize();
+  nzl::Window first(800, 600, "First Window");
+  first.hide();
+  nzl::Window second(800, 600, "Second Window", first);
+  second.hide();
+
+  first.make_current();
+  std::vector<glm::vec3> points{{-0.5f, -0.5f, 0.0f}, {0.5f, 0.5f, 0.0f}};
+  nzl::Line line(glm::vec3(1.0f, 0.0f, 0.0f), points);
+
+  int layouts{0};
+  nzl::VertexArray vertex_array([&layouts] { ++layouts; });
+  vertex_array.bind();
+
+  // The line, uploaded once, is drawn in both windows; the second context
+  // gets vertex arrays of its own.
+  for (int i = 0; i < 3; i++) {
+    first.make_current();
+    glClear(GL_COLOR_BUFFER_BIT);
+    line.render(nzl::TimePoint());
+    first.swap_buffers();
+    EXPECT_EQ(glGetError(), 0u);
+
+    second.make_current();
+    glClear(GL_COLOR_BUFFER_BIT);
+    line.render(nzl::TimePoint());
+    second.swap_buffers();
+    EXPECT_EQ(glGetError(), 0u);
+  }
+
+  vertex_array.bind();
+  EXPECT_EQ(vertex_array.contexts(), 2u);
+  EXPECT_EQ(layouts, 2);
+
+  // Programs are cached per share group.
+  nzl::Line other(glm::vec3(0.0f, 1.0f, 0.0f));
+  EXPECT_EQ(other.get_program().id(), line.get_program().id());
+
+  nzl::VertexArray::release(glfwGetCurrentContext());
+  EXPECT_EQ(vertex_array.contexts(), 1u);
+
+  nzl::terminate();
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
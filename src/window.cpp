@@ -15,6 +15,13 @@
 #include <stdexcept>
 #include <string>
 
+// mxd Library
+#include "frame_uniforms.hpp"
+#include "gpu_profiler.hpp"
+#include "program_cache.hpp"
+#include "render_state.hpp"
+#include "vertex_array.hpp"
+
 // GLEW and GLFW Library
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -33,10 +40,12 @@ struct Window::WindowImp {
   int height{0};
   std::string title{""};
   GLFWwindow* handle{nullptr};
+  bool is_glew_initialized{false};
 
-  WindowImp(Window* window, int width, int height, std::string_view title)
+  WindowImp(Window* window, int width, int height, std::string_view title,
+            GLFWwindow* share = nullptr)
       : width{width}, height{height}, title{title} {
-    handle = glfwCreateWindow(width, height, title.data(), nullptr, nullptr);
+    handle = glfwCreateWindow(width, height, title.data(), nullptr, share);
     if (handle == nullptr) {
       std::ostringstream oss;
       oss << "Error attempting to create " << width << " x " << height
@@ -50,20 +59,38 @@ struct Window::WindowImp {
 
     // In the future we may have more than one `key_callback`.
     glfwSetKeyCallback(handle, key_callback);
+
+    if (share != nullptr) {
+      RenderState::share(handle, share);
+    }
   }
 
   ~WindowImp() noexcept {
     glfwSetWindowUserPointer(handle,
                              nullptr);  // don't mess with window pointer.
+    ProgramCache::release(handle);
+    RenderState::release(handle);
+    FrameUniforms::release(handle);
+    GpuProfiler::release(handle);
+    VertexArray::release(handle);
     glfwDestroyWindow(handle);
     handle = nullptr;
   }
 
   void make_current() {
+    // glfwMakeContextCurrent reaches the window system (and may flush) even
+    // for the current context.
+    if (glfwGetCurrentContext() == handle) {
+      return;
+    }
     glfwMakeContextCurrent(handle);
 
-    // GLEW should be initialized on every context switch
-    // (cf. https://stackoverflow.com/a/35687910)
+    // GLEW must be initialized with every context current at least once
+    // (cf. https://stackoverflow.com/a/35687910); its entry points stay valid
+    // afterwards, so later switches skip it.
+    if (is_glew_initialized) {
+      return;
+    }
     if (auto status = glewInit(); status != GLEW_OK) {
       Window* window = static_cast<Window*>(glfwGetWindowUserPointer(handle));
       if (window) {
@@ -81,6 +108,17 @@ struct Window::WindowImp {
         throw std::runtime_error(oss.str());
       }
     }
+    is_glew_initialized = true;
+
+    // Let the driver compile shaders on as many threads as it likes (see
+    // Program::submit).
+    if (GLEW_KHR_parallel_shader_compile) {
+      glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    } else if (GLEW_ARB_parallel_shader_compile) {
+      glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+
+    FrameUniforms::bind();
   }
 
   void swap_buffers() { glfwSwapBuffers(handle); }
@@ -143,6 +181,11 @@ void key_callback(GLFWwindow* handle, int key, int scancode [[maybe_unused]],
 Window::Window(int width, int height, std::string_view title)
     : m_pimpl{std::make_shared<WindowImp>(this, width, height, title)} {}
 
+Window::Window(int width, int height, std::string_view title,
+               const Window& share)
+    : m_pimpl{std::make_shared<WindowImp>(this, width, height, title,
+                                          share.m_pimpl->handle)} {}
+
 Window::~Window() noexcept {}
 
 int Window::width() const noexcept { return m_pimpl->width; }
@@ -23,6 +23,20 @@ class Window {
   /// @throws std::runtime_error if the Window cannot be created.
   Window(int width, int height, std::string_view title);
 
+  /// @brief Build a Window whose context shares the objects of another.
+  /// @param width Width in pixels.
+  /// @param height Height in pixels.
+  /// @param title Window title.
+  /// @param share Window whose context shares buffers, programs, and
+  /// textures with the new one.
+  /// @throws std::runtime_error if the Window cannot be created.
+  ///
+  /// Geometries created in any window of a share group upload their data
+  /// once and can be drawn in every window of the group; vertex arrays, which
+  /// OpenGL does not share, are created per context as needed (see
+  /// VertexArray).
+  Window(int width, int height, std::string_view title, const Window& share);
+
   /// @brief Destructor.
   ~Window() noexcept;
 
@@ -54,6 +68,8 @@ class Window {
   void hide();
 
   /// @brief Make this Window the current one.
+  /// @note Does nothing if the Window is already current. GLEW is initialized
+  /// only the first time each Window is made current.
   void make_current();
 
  private:
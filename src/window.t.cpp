@@ -36,6 +36,24 @@ TEST(Window, InitializeWindow) {
   nzl::terminate();
 }
 
+TEST(Window, SharedContext) {
+  ASSERT_NO_THROW(nzl::initialize());
+
+  nzl::Window first(800, 600, "First Window");
+  ASSERT_NO_THROW(nzl::Window(800, 600, "Second Window", first));
+  nzl::Window second(800, 600, "Second Window", first);
+  first.hide();
+  second.hide();
+
+  // Switching back and forth, and to the current Window, is allowed.
+  EXPECT_NO_THROW(first.make_current());
+  EXPECT_NO_THROW(first.make_current());
+  EXPECT_NO_THROW(second.make_current());
+  EXPECT_NO_THROW(first.make_current());
+
+  nzl::terminate();
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();